@@ -5,6 +5,11 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <boost/date_time/posix_time/ptime.hpp>
+#include <RingBuffer.hpp>
 
 namespace common {
     
@@ -27,6 +32,12 @@ namespace common {
  *
  * The DUMP may be on screen (standard output), or to a file on disk.
  *
+ * The messages are written asynchronously: the calling thread only checks
+ * the level, takes the time stamp and moves the message into a lock-free
+ * ring buffer. A background writer thread formats the messages and writes
+ * them to their dumps, in the order they were queued. The queue is drained
+ * at program exit and by {@link #flush}.
+ *
  */
 class CLog {
 
@@ -85,7 +96,28 @@ public:
      */
     void fatal(const std::string & logName, const std::string & message);
 
-private:
+    /**
+     * Gets the level defined for a log.
+     *
+     * @param logName Log configuration.
+     * @return        The level of the log, or <code>LOG_UNDEFINED_LEVEL</code> if the log is not defined.
+     */
+    int getLevel(const std::string & logName) const;
+
+    /**
+     * Checks whether the messages of a level are written to a log.
+     *
+     * @param logName Log configuration.
+     * @param level   The severity level.
+     * @return        <code>true</code> if the messages of the level are written.
+     */
+    bool isEnabled(const std::string & logName, int level) const;
+
+    /**
+     * Waits until every message queued so far is written.
+     */
+    void flush(void);
+
     //! Debug levels.
     const static int LOG_DEBUG_LEVEL   = 0;
     const static int LOG_INFO_LEVEL    = 1;
@@ -93,6 +125,30 @@ private:
     const static int LOG_ERROR_LEVEL   = 3;
     const static int LOG_FATAL_LEVEL   = 4;
 
+    //! The level of an undefined log
+    const static int LOG_UNDEFINED_LEVEL = -1;
+
+private:
+    /**
+     * A message waiting to be written.
+     */
+    struct LogEntry {
+        //! The severity level
+        int level;
+
+        //! The dump name, owned by the dump name map
+        const std::string * pDump;
+
+        //! The time the message was logged
+        boost::posix_time::ptime time;
+
+        //! The message text
+        std::string message;
+    };
+
+    //! The number of messages the ring buffer holds
+    const static size_t LOG_QUEUE_SIZE = 8192;
+
     //! The log configuration path file name
     static std::string __logConfig;
 
@@ -111,6 +167,42 @@ private:
     //! Maps a log configuration id with a dump configuration id
     std::map<std::string, std::string> dumpNames;
 
+    //! The messages waiting to be written
+    RingBuffer<LogEntry> queue;
+
+    //! The number of messages queued
+    std::atomic<unsigned long> queued;
+
+    //! The number of messages written
+    std::atomic<unsigned long> written;
+
+    //! Whether the writer thread is stopping
+    std::atomic<bool> stopping;
+
+    //! Whether the writer thread is joined, so the callers write their messages
+    std::atomic<bool> joined;
+
+    //! Guards the writer thread sleep and the flush waits
+    std::mutex writerMtx;
+
+    //! Wakes up the writer thread
+    std::condition_variable writerCond;
+
+    //! Wakes up the flush waits once the queue is drained
+    std::condition_variable flushCond;
+
+    //! Serializes the writes to the dumps and the time stamp cache
+    std::mutex writeMtx;
+
+    //! The second of the cached time stamp
+    boost::posix_time::ptime stampSecond;
+
+    //! The cached time stamp up to the seconds
+    std::string stampPrefix;
+
+    //! The background writer thread
+    std::thread writer;
+
     
     /**
      * Constructor of the CLog class.
@@ -154,6 +246,36 @@ private:
 	 * @param message The message we are going to send to the target log. 
 	 */
 	void logMessage(int level, const std::string & logName, std::string message); 
+
+	/**
+	 * The writer thread loop. Writes the queued messages until the log stops.
+	 */
+	void writeMessages(void);
+
+	/**
+	 * Writes the queued messages, holding the write mutex.
+	 *
+	 * @return <code>true</code> if any message was written.
+	 */
+	bool drainMessages(void);
+
+	/**
+	 * Stops and joins the writer thread, and writes the messages it left in the queue.
+	 */
+	void stop(void);
+
+	/**
+	 * Formats and writes a message to its dump.
+	 *
+	 * @param entry The message.
+	 */
+	void writeMessage(LogEntry & entry);
+
+	/**
+	 * Stops the writer thread once every queued message is written.
+	 * Registered to run at program exit.
+	 */
+	static void shutdown(void);
 };
 
 } /* namespace */
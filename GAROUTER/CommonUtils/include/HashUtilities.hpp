@@ -0,0 +1,83 @@
+/*
+ * HashUtilities.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef HASHUTILITIES_HPP_
+#define HASHUTILITIES_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace common {
+
+/**
+ * A 128-bit hash value.
+ */
+struct Hash128 {
+	//! The low 64 bits
+	uint64_t lo;
+
+	//! The high 64 bits
+	uint64_t hi;
+
+	bool operator==(const Hash128& other) const {
+		return lo == other.lo && hi == other.hi;
+	}
+
+	bool operator!=(const Hash128& other) const {
+		return !(*this == other);
+	}
+};
+
+/**
+ * This class provides several common utilities for hashing data.
+ */
+class HashUtilities {
+
+public:
+
+	/**
+	 * Compute the 128-bit MurmurHash3 (x64 variant) of a byte array.
+	 * The hash is not cryptographic, but the collisions of two different
+	 * arrays are negligible for caching purposes.
+	 * @param data	The bytes to hash.
+	 * @param len	The number of bytes.
+	 * @param seed	The hash seed.
+	 * @return		The 128-bit hash of the bytes.
+	 */
+	static Hash128 hash128(const void* data, size_t len, uint64_t seed = 0);
+
+	/**
+	 * Combine two 128-bit hashes into a new one.
+	 * @param h1	A hash.
+	 * @param h2	Another hash.
+	 * @return		The combined hash. It depends on the order of the arguments.
+	 */
+	static Hash128 combine(const Hash128& h1, const Hash128& h2);
+
+	/**
+	 * Compute the 128-bit hash of the contents of a file.
+	 * The file is read in chunks, and the hash is the chained combination of the chunk hashes.
+	 * @param path	The file path.
+	 * @param hash	The hash of the file contents, set on success.
+	 * @return		<code>true</code> if the file is hashed, <code>false</code> if it can't be read.
+	 */
+	static bool hashFile(const std::string& path, Hash128& hash);
+};
+
+/**
+ * Functor hashing a 128-bit hash into a standard container bucket.
+ */
+struct Hash128Hasher {
+	size_t operator()(const Hash128& h) const {
+		return (size_t)(h.lo ^ (h.hi * 0x9E3779B97F4A7C15ULL));
+	}
+};
+
+} /* namespace common */
+
+#endif /* HASHUTILITIES_HPP_ */
@@ -0,0 +1,172 @@
+/*
+ * RingBuffer.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef RINGBUFFER_HPP_
+#define RINGBUFFER_HPP_
+
+#include <vector>
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+namespace common {
+
+/**
+ * A bounded, lock-free multi-producer multi-consumer queue.
+ *
+ * The slots are allocated once. Every slot carries a sequence number
+ * telling whether it is free for the producer or filled for the consumer
+ * of a given lap, so the producers and consumers only contend on their
+ * own position counter. The values are moved in and out of the slots.
+ */
+template<class T>
+class RingBuffer {
+
+public:
+
+	/**
+	 * Deleted default constructor.
+	 */
+	RingBuffer(void) = delete;
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other ring buffer.
+	 */
+	RingBuffer(const RingBuffer& other) = delete;
+
+	/**
+	 * Deleted assignment operator.
+	 * @param rhs	Other ring buffer.
+	 * @return		This ring buffer.
+	 */
+	RingBuffer& operator=(const RingBuffer& rhs) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param capacity	The minimum number of slots. It is rounded up to a power of two.
+	 */
+	explicit RingBuffer(size_t capacity)
+	: slots       (roundUp(capacity)),
+	  mask        (slots.size() - 1),
+	  enqueuePos  (0),
+	  dequeuePos  (0) {
+		for (size_t i = 0; i < slots.size(); i++) {
+			slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Get the number of slots.
+	 * @return	The number of slots.
+	 */
+	size_t capacity(void) const {
+		return slots.size();
+	}
+
+	/**
+	 * Move a value into the queue if there is a free slot.
+	 * @param value	The value. It is left moved-from on success.
+	 * @return		<code>true</code> if the value is queued, <code>false</code> if the queue is full.
+	 */
+	bool tryPush(T& value) {
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+		Slot* slot;
+
+		while (true) {
+			slot = &slots[pos & mask];
+			size_t seq = slot->sequence.load(std::memory_order_acquire);
+			long diff = long(seq) - long(pos);
+
+			if (diff == 0) {
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			} else if (diff < 0) {
+				return false;
+			} else {
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->value = std::move(value);
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Move the oldest value out of the queue if there is one.
+	 * @param value	The value, set on success.
+	 * @return		<code>true</code> if a value is dequeued, <code>false</code> if the queue is empty.
+	 */
+	bool tryPop(T& value) {
+		size_t pos = dequeuePos.load(std::memory_order_relaxed);
+		Slot* slot;
+
+		while (true) {
+			slot = &slots[pos & mask];
+			size_t seq = slot->sequence.load(std::memory_order_acquire);
+			long diff = long(seq) - long(pos + 1);
+
+			if (diff == 0) {
+				if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			} else if (diff < 0) {
+				return false;
+			} else {
+				pos = dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		value = std::move(slot->value);
+		slot->sequence.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+
+	/**
+	 * A queue slot.
+	 */
+	struct Slot {
+		//! The lap sequence number of the slot
+		std::atomic<size_t> sequence;
+
+		//! The stored value
+		T value;
+	};
+
+	/**
+	 * Round a capacity up to a power of two.
+	 * @param capacity	The capacity.
+	 * @return			The lowest power of two not lower than the capacity, at least 2.
+	 */
+	static size_t roundUp(size_t capacity) {
+		size_t size = 2;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		return size;
+	}
+
+	//! The slots
+	std::vector<Slot> slots;
+
+	//! The slot index mask
+	const size_t mask;
+
+	//! The next enqueue position
+	std::atomic<size_t> enqueuePos;
+
+	//! The next dequeue position
+	std::atomic<size_t> dequeuePos;
+};
+
+} /* namespace common */
+
+#endif /* RINGBUFFER_HPP_ */
@@ -0,0 +1,127 @@
+/*
+ * ThreadPool.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef THREADPOOL_HPP_
+#define THREADPOOL_HPP_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+
+namespace common {
+
+/**
+ * A fixed-size pool of worker threads running indexed loops.
+ *
+ * The worker threads are created once and sleep between loops. A loop
+ * hands out its indices one by one to the workers and to the calling
+ * thread, which also takes part in the work, and returns when every
+ * index has been processed. If a task throws, the first exception is
+ * rethrown in the calling thread once the loop is over.
+ */
+class ThreadPool {
+
+public:
+
+	/**
+	 * Deleted default constructor.
+	 */
+	ThreadPool(void) = delete;
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other thread pool.
+	 */
+	ThreadPool(const ThreadPool& other) = delete;
+
+	/**
+	 * Deleted assignment operator.
+	 * @param rhs	Other thread pool.
+	 * @return		This thread pool.
+	 */
+	ThreadPool& operator=(const ThreadPool& rhs) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param numThreads	The number of threads running the loops, including the calling thread.
+	 * 						A value of 0 or 1 runs the loops serially in the calling thread.
+	 */
+	explicit ThreadPool(unsigned int numThreads);
+
+	/**
+	 * Virtual destructor.
+	 * Stops and joins the worker threads.
+	 */
+	virtual ~ThreadPool(void);
+
+	/**
+	 * Get the number of threads running the loops, including the calling thread.
+	 * @return	The number of threads.
+	 */
+	unsigned int size(void) const;
+
+	/**
+	 * Run a task for every index in [0, count) and wait for all of them.
+	 * The order in which the indices are processed is unspecified.
+	 * @param count	The number of indices.
+	 * @param task	The task to run for every index.
+	 */
+	void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+private:
+
+	/**
+	 * The worker thread loop.
+	 */
+	void work(void);
+
+	/**
+	 * Process indices of the current loop until there are none left.
+	 */
+	void runTasks(void);
+
+	//! The worker threads
+	std::vector<std::thread> workers;
+
+	//! Guards the loop state
+	std::mutex mtx;
+
+	//! Wakes up the workers when a loop starts or the pool stops
+	std::condition_variable startCond;
+
+	//! Wakes up the calling thread when the workers leave a loop
+	std::condition_variable doneCond;
+
+	//! The task of the current loop
+	const std::function<void(size_t)>* pTask;
+
+	//! The number of indices of the current loop
+	size_t count;
+
+	//! The next index to process in the current loop
+	std::atomic<size_t> next;
+
+	//! The number of workers inside the current loop
+	unsigned int busy;
+
+	//! The loop counter, to tell a new loop from a spurious wake-up
+	unsigned long loop;
+
+	//! Whether the pool is stopping
+	bool stopping;
+
+	//! The first exception thrown by a task in the current loop
+	std::exception_ptr error;
+};
+
+} /* namespace common */
+
+#endif /* THREADPOOL_HPP_ */
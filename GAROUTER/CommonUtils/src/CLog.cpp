@@ -1,9 +1,10 @@
 #include <EnvironmentUtil.hpp>
 #include <stdlib.h>
+#include <cstdio>
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/date_time/posix_time/posix_time_io.hpp>
 #include <CDump.hpp>
 #include <CLog.hpp>
 #include <FileTokenizer.hpp>
@@ -22,8 +23,9 @@ using std::endl;
 using std::unique_ptr;
 using std::once_flag;
 using std::ostringstream;
+using std::mutex;
+using std::unique_lock;
 using boost::posix_time::ptime;
-using boost::posix_time::time_facet;
 
 
 namespace common {
@@ -78,17 +80,79 @@ void CLog::fatal(const string & logName, const string & message) {
 
 //...................................................... constructor and destructor ...
 CLog::CLog(const string & logConfig,
-		   const string & dumpConfig) {
+		   const string & dumpConfig)
+: queue    (LOG_QUEUE_SIZE),
+  queued   (0),
+  written  (0),
+  stopping (false),
+  joined   (false) {
 	// Resolve the log and dump configuration path names
 	__logConfig  = EnvironmentUtil::transformString(logConfig, _ISWIN32);
 	__dumpConfig = EnvironmentUtil::transformString(dumpConfig, _ISWIN32);
 
     //Read the configuration file
     getConfiguration(__logConfig);
+
+    //Start the writer thread, and drain the queue before the static objects are destroyed
+    writer = std::thread(&CLog::writeMessages, this);
+    std::atexit(&CLog::shutdown);
 }
 
 CLog::~CLog() {
-    //Destructor is empty
+    stop();
+}
+
+
+
+//...................................................... shutdown ...
+void CLog::shutdown(void) {
+    if (__instance == nullptr) {
+        return;
+    }
+
+    __instance->stop();
+}
+
+
+void CLog::stop(void) {
+    stopping = true;
+    writerCond.notify_one();
+    if (writer.joinable()) {
+        writer.join();
+    }
+
+    //The writer may leave behind the messages queued while it was leaving
+    joined = true;
+    drainMessages();
+    {
+        unique_lock<mutex> lock(writerMtx);
+    }
+    flushCond.notify_all();
+}
+
+
+
+//...................................................... level checks ...
+int CLog::getLevel(const string & logName) const {
+    map<string, int>::const_iterator itrLevel = logLevels.find(logName);
+    return (itrLevel != logLevels.end()) ? itrLevel->second : LOG_UNDEFINED_LEVEL;
+}
+
+
+bool CLog::isEnabled(const string & logName, int level) const {
+    int currentLevel = getLevel(logName);
+    return (currentLevel != LOG_UNDEFINED_LEVEL) && (currentLevel <= level);
+}
+
+
+
+//...................................................... flush ...
+void CLog::flush(void) {
+    unsigned long target = queued.load();
+
+    unique_lock<mutex> lock(writerMtx);
+    writerCond.notify_one();
+    flushCond.wait(lock, [this, target] { return written.load() >= target || joined; });
 }
 
 
@@ -207,71 +271,143 @@ void CLog::getConfiguration(const string & configFile) {
 
 //...................................................... logMessage ...
 void CLog::logMessage(int level, const string & logName, string message) {
-    map<string, int>::iterator    itrLevel; //To find the level defined for the log
-    map<string, string>::iterator itrDump;  //To find the dump associated with the log
-    int currentLevel;                       //Current level of trace defined
-    string notification;                    //Time and severity text
-    string fullMessage;                     //Full message
+    //Find the level defined for the current log
+    map<string, int>::iterator itrLevel = logLevels.find(logName);
+    if (itrLevel == logLevels.end()) {
+        cout << endl << "CLog::logMessage: no log level defined for " << logName << ". Check log configuration file.";
+        return;
+    }
 
-    time_facet * facet;						// Facet for date-time format
+    //Leave out the messages below the level of the log
+    if (itrLevel->second > level) {
+        return;
+    }
 
-    ostringstream oss;                      //Output string stream to convert the date and time
+    //Find the dump
+    map<string, string>::iterator itrDump = dumpNames.find(logName);
+    if (itrDump == dumpNames.end()) {
+        cout << endl << "CLog::logMessage: no dump defined for [" << logName << "]";
+        return;
+    }
 
+    LogEntry entry;
+    entry.level   = level;
+    entry.pDump   = &itrDump->second;
+    entry.time    = boost::posix_time::microsec_clock::local_time();
+    entry.message = std::move(message);
 
-    //Find the level defined for the current log
-    itrLevel = logLevels.find(logName);
-    if (itrLevel == logLevels.end()) {
-        cout << endl << "CLog::logMessage: no log level defined for " << logName << ". Check log configuration file.";
+    //Write the message in the calling thread once the writer thread is joined
+    if (joined) {
+        unique_lock<mutex> lock(writeMtx);
+        writeMessage(entry);
         return;
     }
 
-    //Get the level for the logName
-    currentLevel = itrLevel->second;
-
-    if (currentLevel <= level) {
-        //Build the notification line
-        notification = "";
-        switch(level) {
-            case LOG_DEBUG_LEVEL  :notification.append("[DEBUG|");break;
-            case LOG_INFO_LEVEL   :notification.append("[INFO |");break;
-            case LOG_WARNING_LEVEL:notification.append("[WARN |");break;
-            case LOG_ERROR_LEVEL  :notification.append("[ERROR|");break;
-            case LOG_FATAL_LEVEL  :notification.append("[FATAL|");break;
-        }
-        
-        //Append the date-time the log is generated
-        // Set a facet format for date-time in microseconds precision and imbue to output stream
-        facet = new time_facet("%Y%m%d %H%M%S.%f");
-        oss.imbue(std::locale(oss.getloc(), facet));
-        
-        // Append local time in microseconds precision to output string in the facet format
-        oss << boost::posix_time::microsec_clock::local_time() << "]: ";
-
-        notification.append(oss.str());        
-                
-        //Remove final EOL to the message
-        if (message.size()>0) {
-            if (message[message.size()-1] == '\n')
-                message = message.substr(0, message.size()-1);
+    //Queue the message, waiting for the writer thread if the queue is full
+    while (!queue.tryPush(entry)) {
+        if (joined) {
+            drainMessages();
+        } else {
+            writerCond.notify_one();
+            std::this_thread::yield();
         }
-            
-        //Build final string
-        fullMessage = notification + message;    
-            
-        //Find the dump
-        itrDump = dumpNames.find(logName);
-
-        //If the second value is SCREEN, do not call CDump
-        if (itrDump == dumpNames.end()) {
-            cout << endl << "CLog::logMessage: no dump defined for [" << logName << "]";
-        }
-        else if (itrDump->second == "SCREEN") {
-            cout << fullMessage << endl;
+    }
+    queued.fetch_add(1);
+
+    //The writer may have been joined after the check, so nobody else would write it
+    if (joined) {
+        drainMessages();
+    }
+}
+
+
+
+//...................................................... writeMessages ...
+void CLog::writeMessages(void) {
+    while (true) {
+        bool any = drainMessages();
+
+        //Wake up the flush waits once the queue is drained
+        if (any) {
+            unique_lock<mutex> lock(writerMtx);
+            flushCond.notify_all();
+            continue;
         }
-        else {
-            //Dump fullMessage
-            CDump::GetInstance(__dumpConfig)->dumpInstant(itrDump->second, fullMessage);
+
+        //Sleep until new messages are queued, leaving once the queue is drained
+        if (stopping) {
+            break;
         }
+        unique_lock<mutex> lock(writerMtx);
+        writerCond.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
+
+
+
+//...................................................... drainMessages ...
+bool CLog::drainMessages(void) {
+    LogEntry entry;
+    bool any = false;
+
+    unique_lock<mutex> lock(writeMtx);
+    while (queue.tryPop(entry)) {
+        writeMessage(entry);
+        written.fetch_add(1);
+        any = true;
+    }
+
+    return any;
+}
+
+
+
+//...................................................... writeMessage ...
+void CLog::writeMessage(LogEntry & entry) {
+    string fullMessage;                     //Full message
+    char fraction[16];                      //Microseconds of the time stamp
+
+    //Build the notification line
+    switch(entry.level) {
+        case LOG_DEBUG_LEVEL  :fullMessage.append("[DEBUG|");break;
+        case LOG_INFO_LEVEL   :fullMessage.append("[INFO |");break;
+        case LOG_WARNING_LEVEL:fullMessage.append("[WARN |");break;
+        case LOG_ERROR_LEVEL  :fullMessage.append("[ERROR|");break;
+        case LOG_FATAL_LEVEL  :fullMessage.append("[FATAL|");break;
+    }
+
+    //Append the date-time the log is generated, formatting the date and the seconds once per second
+    boost::posix_time::time_duration tod = entry.time.time_of_day();
+    ptime second (entry.time.date(), boost::posix_time::seconds(tod.total_seconds()));
+    if (second != stampSecond) {
+        char prefix[32];
+        boost::gregorian::date date = entry.time.date();
+        snprintf(prefix, sizeof(prefix), "%04d%02d%02d %02d%02d%02d",
+                 int(date.year()), int(date.month().as_number()), int(date.day()),
+                 int(tod.hours()), int(tod.minutes()), int(tod.seconds()));
+        stampPrefix = prefix;
+        stampSecond = second;
+    }
+    snprintf(fraction, sizeof(fraction), ".%06ld]: ", long(tod.fractional_seconds()));
+    fullMessage.append(stampPrefix);
+    fullMessage.append(fraction);
+
+    //Remove final EOL to the message
+    string & message = entry.message;
+    if (message.size() > 0 && message[message.size()-1] == '\n') {
+        message.resize(message.size()-1);
+    }
+
+    //Build final string
+    fullMessage.append(message);
+
+    //If the dump is SCREEN, do not call CDump
+    if (*entry.pDump == "SCREEN") {
+        cout << fullMessage << endl;
+    }
+    else {
+        //Dump fullMessage
+        CDump::GetInstance(__dumpConfig)->dumpInstant(*entry.pDump, fullMessage);
     }
 }
 
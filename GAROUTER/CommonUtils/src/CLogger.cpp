@@ -15,6 +15,9 @@ CLogger::CLogger(const string & logId,
 
     //Assign the parameter log name
     logName = logId;
+
+    //Cache the level of the log
+    logLevel = log->getLevel(logName);
 }
 
 
@@ -27,23 +30,36 @@ CLogger::~CLogger() {
 
 //...................................................... logging methods ...
 void CLogger::debug(const string & message) {
-    log->debug(logName, message);
+    if (logLevel <= CLog::LOG_DEBUG_LEVEL) {
+        log->debug(logName, message);
+    }
 }
 
 void CLogger::info(const string & message) {
-    log->info(logName, message);
+    if (logLevel <= CLog::LOG_INFO_LEVEL) {
+        log->info(logName, message);
+    }
 }
 
 void CLogger::warning(const string & message) {
-    log->warning(logName, message);
+    if (logLevel <= CLog::LOG_WARNING_LEVEL) {
+        log->warning(logName, message);
+    }
 }
 
 void CLogger::error(const string & message) {
-    log->error(logName, message);
+    if (logLevel <= CLog::LOG_ERROR_LEVEL) {
+        log->error(logName, message);
+    }
 }
 
 void CLogger::fatal(const string & message) {
     log->fatal(logName, message);
+    log->flush();
+}
+
+void CLogger::flush(void) {
+    log->flush();
 }
 
 } /* namespace common */
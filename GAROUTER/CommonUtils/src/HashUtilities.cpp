@@ -0,0 +1,144 @@
+/*
+ * HashUtilities.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <HashUtilities.hpp>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace common {
+
+//........................................... Rotate a 64-bit word to the left ...
+static inline uint64_t rotl64(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+//........................................... Finalization mix of a 64-bit word ...
+static inline uint64_t fmix64(uint64_t k) {
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdULL;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k >> 33;
+	return k;
+}
+
+
+//........................................... Compute the 128-bit hash of a byte array ...
+Hash128 HashUtilities::hash128(const void* data, size_t len, uint64_t seed) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	const size_t nblocks = len / 16;
+
+	uint64_t h1 = seed;
+	uint64_t h2 = seed;
+
+	const uint64_t c1 = 0x87c37b91114253d5ULL;
+	const uint64_t c2 = 0x4cf5ad432745937fULL;
+
+	// Body: the 16-byte blocks
+	for (size_t i = 0; i < nblocks; i++) {
+		uint64_t k1;
+		uint64_t k2;
+		std::memcpy(&k1, bytes + i * 16, 8);
+		std::memcpy(&k2, bytes + i * 16 + 8, 8);
+
+		k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+		h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+		k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+		h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+	}
+
+	// Tail: the remaining bytes
+	const uint8_t* tail = bytes + nblocks * 16;
+	uint64_t k1 = 0;
+	uint64_t k2 = 0;
+
+	switch (len & 15) {
+	case 15: k2 ^= uint64_t(tail[14]) << 48;
+		// fall through
+	case 14: k2 ^= uint64_t(tail[13]) << 40;
+		// fall through
+	case 13: k2 ^= uint64_t(tail[12]) << 32;
+		// fall through
+	case 12: k2 ^= uint64_t(tail[11]) << 24;
+		// fall through
+	case 11: k2 ^= uint64_t(tail[10]) << 16;
+		// fall through
+	case 10: k2 ^= uint64_t(tail[ 9]) << 8;
+		// fall through
+	case  9: k2 ^= uint64_t(tail[ 8]) << 0;
+			 k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+		// fall through
+	case  8: k1 ^= uint64_t(tail[ 7]) << 56;
+		// fall through
+	case  7: k1 ^= uint64_t(tail[ 6]) << 48;
+		// fall through
+	case  6: k1 ^= uint64_t(tail[ 5]) << 40;
+		// fall through
+	case  5: k1 ^= uint64_t(tail[ 4]) << 32;
+		// fall through
+	case  4: k1 ^= uint64_t(tail[ 3]) << 24;
+		// fall through
+	case  3: k1 ^= uint64_t(tail[ 2]) << 16;
+		// fall through
+	case  2: k1 ^= uint64_t(tail[ 1]) << 8;
+		// fall through
+	case  1: k1 ^= uint64_t(tail[ 0]) << 0;
+			 k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+	}
+
+	// Finalization
+	h1 ^= len;
+	h2 ^= len;
+
+	h1 += h2;
+	h2 += h1;
+
+	h1 = fmix64(h1);
+	h2 = fmix64(h2);
+
+	h1 += h2;
+	h2 += h1;
+
+	Hash128 hash;
+	hash.lo = h1;
+	hash.hi = h2;
+	return hash;
+}
+
+
+//........................................... Combine two 128-bit hashes ...
+Hash128 HashUtilities::combine(const Hash128& h1, const Hash128& h2) {
+	uint64_t words[4] = { h1.lo, h1.hi, h2.lo, h2.hi };
+	return hash128(words, sizeof(words));
+}
+
+
+//........................................... Compute the 128-bit hash of a file ...
+bool HashUtilities::hashFile(const std::string& path, Hash128& hash) {
+	std::ifstream in(path, std::ios::binary);
+	if (!in.is_open()) {
+		return false;
+	}
+
+	std::vector<char> chunk(1 << 20);
+	hash = hash128(nullptr, 0);
+
+	while (in) {
+		in.read(chunk.data(), chunk.size());
+		std::streamsize count = in.gcount();
+		if (count <= 0) {
+			break;
+		}
+		hash = combine(hash, hash128(chunk.data(), (size_t)count));
+	}
+
+	return !in.bad();
+}
+
+} /* namespace common */
@@ -0,0 +1,150 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <ThreadPool.hpp>
+
+using std::vector;
+using std::thread;
+using std::mutex;
+using std::unique_lock;
+using std::lock_guard;
+using std::function;
+using std::exception_ptr;
+
+namespace common {
+
+//...................................................... constructor and destructor ...
+ThreadPool::ThreadPool(unsigned int numThreads)
+: workers   (vector<thread>()),
+  pTask     (nullptr),
+  count     (0),
+  next      (0),
+  busy      (0),
+  loop      (0),
+  stopping  (false),
+  error     (nullptr) {
+	// The calling thread is one of the threads running the loops
+	for (unsigned int i = 1; i < numThreads; i++) {
+		workers.emplace_back(&ThreadPool::work, this);
+	}
+}
+
+ThreadPool::~ThreadPool(void) {
+	{
+		lock_guard<mutex> lock(mtx);
+		stopping = true;
+	}
+	startCond.notify_all();
+
+	for (thread& worker : workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+}
+
+
+
+//...................................................... Get the number of threads ...
+unsigned int ThreadPool::size(void) const {
+	return workers.size() + 1;
+}
+
+
+
+//...................................................... Run an indexed loop ...
+void ThreadPool::parallelFor(size_t count, const function<void(size_t)>& task) {
+	if (count == 0) {
+		return;
+	}
+
+	// Run serially when there is nobody to share the work with
+	if (workers.empty() || count == 1) {
+		for (size_t i = 0; i < count; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	// Publish the loop and wake up the workers
+	{
+		lock_guard<mutex> lock(mtx);
+		this->pTask = &task;
+		this->count = count;
+		this->next.store(0);
+		this->error = nullptr;
+		this->busy = workers.size();
+		this->loop++;
+	}
+	startCond.notify_all();
+
+	// Take part in the loop
+	runTasks();
+
+	// Wait for the workers to leave the loop
+	unique_lock<mutex> lock(mtx);
+	doneCond.wait(lock, [this] () { return busy == 0; });
+
+	exception_ptr loopError = error;
+	pTask = nullptr;
+	error = nullptr;
+	lock.unlock();
+
+	if (loopError) {
+		std::rethrow_exception(loopError);
+	}
+}
+
+
+
+//...................................................... worker thread loop ...
+void ThreadPool::work(void) {
+	unsigned long seen = 0;
+
+	while (true) {
+		{
+			unique_lock<mutex> lock(mtx);
+			startCond.wait(lock, [this, seen] () { return stopping || loop != seen; });
+			if (stopping) {
+				return;
+			}
+			seen = loop;
+		}
+
+		runTasks();
+
+		{
+			lock_guard<mutex> lock(mtx);
+			if (--busy == 0) {
+				doneCond.notify_one();
+			}
+		}
+	}
+}
+
+
+
+//...................................................... process the loop indices ...
+void ThreadPool::runTasks(void) {
+	while (true) {
+		size_t i = next.fetch_add(1);
+		if (i >= count) {
+			return;
+		}
+
+		try {
+			(*pTask)(i);
+		} catch (...) {
+			lock_guard<mutex> lock(mtx);
+			if (!error) {
+				error = std::current_exception();
+			}
+		}
+	}
+}
+
+} /* namespace common */
@@ -86,6 +86,9 @@ public:
 	void setFlows(const std::string& detector_id, std::vector<FlowDef>&);
 
 	const std::vector<FlowDef>& getFlowDefs(const std::string& id) const;
+
+	/// @brief Get the flows of a detector for writing, adding empty flows for every time step if it has none
+	std::vector<FlowDef>& getOrAddFlowDefs(const std::string& id);
 	bool knows(const std::string& det_id) const;
 	SUMOReal getFlowSumSecure(const std::string& id) const;
 	SUMOReal getMaxDetectorFlow() const;
@@ -0,0 +1,193 @@
+/*
+ * GARMesoSim.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARMESOSIM_HPP_
+#define GARMESOSIM_HPP_
+
+#include <GARRouteCont.hpp>
+#include <GARDetectorCon.hpp>
+#include <GARDetectorFlow.hpp>
+#include <utils/common/SUMOTime.h>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gar {
+
+/**
+ * @brief This class implements an event-driven mesoscopic queue simulator.
+ * It is a lightweight, in-process replacement of the SUMO simulation run by the dynamic approach.
+ *
+ * Every edge is modelled as a point queue: a vehicle runs along the edge at the edge speed and
+ * then waits at its downstream end until the edge can discharge it. An edge discharges one vehicle
+ * per lane every saturation headway. The vehicles depart on the first lane at the position of a
+ * detector on the first edge of their route, as the emitters written for SUMO do.
+ *
+ * The simulator counts the vehicles passing every detector per time step and returns them in the
+ * same detector flow layout the SUMO induction loop measurements are read into. Lanes are not
+ * modelled, so the vehicles passing an edge are spread over the lanes holding its detectors,
+ * except on their depart edge, where they only pass the detectors of the first lane.
+ *
+ * The routes and detectors are compiled once. The simulation keeps all its state in local data,
+ * so concurrent simulations may share a simulator.
+ */
+class GARMesoSim {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARMesoSim(void) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param pRouCont	The routes container.
+	 * @param pDetCont	The detectors container.
+	 * @param begin		The simulation beginning time in seconds.
+	 * @param end		The simulation end time in seconds.
+	 * @param timeStep	The time interval in seconds between two successive detector flows.
+	 */
+	GARMesoSim(const GARRouteCont const* pRouCont,
+			   const GARDetectorCon const* pDetCont,
+			   const SUMOTime& begin,
+			   const SUMOTime& end,
+			   const SUMOTime& timeStep);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARMesoSim(void) = default;
+
+	/**
+	 * Get the saturation headway of a lane.
+	 * @return	The saturation headway in seconds.
+	 */
+	SUMOReal getHeadway(void) const;
+
+	/**
+	 * Set the saturation headway of a lane.
+	 * @param headway	The saturation headway in seconds.
+	 */
+	void setHeadway(const SUMOReal& headway);
+
+	/**
+	 * Simulate the vehicles and count them at the detectors.
+	 * @param routeNames	The route name of every vehicle. The vehicles with an empty route name are skipped.
+	 * @param departs		The depart time in seconds of every vehicle.
+	 * @return				The detector flows of the simulation, holding every detector and every time step,
+	 * 						or <code>nullptr</code> if a route is unknown.
+	 */
+	std::shared_ptr<GARDetectorFlows> simulate(const std::vector<std::string>& routeNames,
+											   const std::vector<int>& departs) const;
+
+private:
+	/**
+	 * A detector cross-section on an edge.
+	 */
+	struct MesoDetector {
+		//! The position on the edge
+		SUMOReal pos;
+
+		//! The lane group of the edge the detector belongs to
+		uint32_t lane;
+
+		//! The detector index
+		uint32_t detector;
+	};
+
+	/**
+	 * A simulated edge.
+	 */
+	struct MesoEdge {
+		//! The edge length
+		SUMOReal length;
+
+		//! The edge speed
+		SUMOReal speed;
+
+		//! The number of lanes
+		uint32_t numLanes;
+
+		//! The number of lanes holding detectors
+		uint32_t numDetLanes;
+
+		//! The lane group of the first lane, where the vehicles depart, or the number of lane groups if it holds no detector
+		uint32_t firstLane;
+
+		//! The detectors on the edge, sorted by position
+		std::vector<MesoDetector> detectors;
+	};
+
+	/**
+	 * A simulated route.
+	 */
+	struct MesoRoute {
+		//! The edge indices of the route
+		std::vector<uint32_t> edges;
+
+		//! The depart position on the first edge
+		SUMOReal departPos;
+	};
+
+	/**
+	 * Get the index of an edge, adding it to the simulated edges if not yet done.
+	 * @param pEdge	A pointer to the edge.
+	 * @return		The edge index.
+	 */
+	uint32_t addEdge(const ROEdge const* pEdge);
+
+	/**
+	 * Count the vehicle passing the detectors of an edge.
+	 * @param edge		The edge.
+	 * @param lane		The lane group the vehicle runs on.
+	 * @param entryTime	The time the vehicle enters the edge at the entry position.
+	 * @param entryPos	The entry position on the edge.
+	 * @param counts	The vehicle counts per detector and time step.
+	 * @param speeds	The speed sums per detector and time step.
+	 */
+	void countDetectors(const MesoEdge& edge,
+						uint32_t lane,
+						double entryTime,
+						SUMOReal entryPos,
+						std::vector<uint32_t>& counts,
+						std::vector<double>& speeds) const;
+
+	//! The simulated edges
+	std::vector<MesoEdge> edges;
+
+	//! The edge indices by edge identifier
+	std::unordered_map<std::string, uint32_t> edgeIndices;
+
+	//! The simulated routes
+	std::vector<MesoRoute> routes;
+
+	//! The route indices by route name
+	std::unordered_map<std::string, uint32_t> routeIndices;
+
+	//! The detector identifiers
+	std::vector<std::string> detectorIds;
+
+	//! The simulation beginning time in seconds
+	SUMOTime begin;
+
+	//! The simulation end time in seconds
+	SUMOTime end;
+
+	//! The time interval between two successive detector flows
+	SUMOTime timeStep;
+
+	//! The number of time steps of the detector flows
+	uint32_t numSteps;
+
+	//! The saturation headway of a lane in seconds
+	SUMOReal headway;
+};
+
+} /* namespace gar */
+
+#endif /* GARMESOSIM_HPP_ */
@@ -42,6 +42,9 @@
 #include <utils/common/StdDefs.h>
 #include <utils/common/SUMOTime.h>
 #include <CLogger.hpp>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
 
 using gar::GARTazCont;
 using gar::GARTripCont;
@@ -77,6 +80,13 @@ typedef std::set<const RONode const*,lex_compare_node> node_set;
  */
 class GARNet: public RONet {
 public:
+	/// @brief The limits of the route search from the source edges
+	struct RouteSearchLimits {
+		bool dominance;			/// @brief Whether to prune the partial routes dominated by a faster one over the same edge and detectors
+		size_t maxLabels;		/// @brief The live partial routes kept per source edge, 0 for no limit
+		size_t memoryBudget;	/// @brief The bytes of the partial routes of all the searches, split in equal shares between the source edges, 0 for no limit
+	};
+
 	/** @brief Constructor
 	 */
 	GARNet(void);
@@ -95,6 +105,8 @@ public:
 					 GARRouteCont& rouCont,
 					 GARTripCont& tripCont,
 					 int maxFollowingLength,
+					 const RouteSearchLimits& limits,
+					 int numThreads,
 					 common::CLogger* logger) const;
 
 	SUMOReal getAbsPos(const GARDetector& det) const;
@@ -117,8 +129,57 @@ public:
 
 	void mesoJoin(GARDetectorCon& detectors, GARDetectorFlows& flows);
 
+	/// @brief A range of the edges in the approach lists
+	struct EdgeSpan {
+		typedef ROEdge* const* iterator;
+		iterator first;
+		iterator last;
+
+		iterator begin() const {
+			return first;
+		}
+		iterator end() const {
+			return last;
+		}
+		size_t size() const {
+			return last - first;
+		}
+		ROEdge* operator[](size_t i) const {
+			return first[i];
+		}
+	};
+
+	/// @brief A range of the detector ids in the detector lists
+	struct DetectorSpan {
+		typedef const std::string* iterator;
+		iterator first;
+		iterator last;
+
+		iterator begin() const {
+			return first;
+		}
+		iterator end() const {
+			return last;
+		}
+		size_t size() const {
+			return last - first;
+		}
+		bool empty() const {
+			return first == last;
+		}
+		const std::string& operator[](size_t i) const {
+			return first[i];
+		}
+	};
+
+	/// @brief Gets the edges approaching an edge
+	EdgeSpan getApproaching(const ROEdge* edge) const;
+
+	/// @brief Gets the edges approached by an edge
+	EdgeSpan getApproached(const ROEdge* edge) const;
+
 	bool hasDetector(ROEdge* edge) const;
-	const std::vector<std::string>& getDetectorList(ROEdge* edge) const;
+	DetectorSpan getDetectorList(const ROEdge* edge) const;
 
 	const node_set& getNodeList(void) const;
 
@@ -144,14 +205,45 @@ protected:
 	bool isDestination(const GARDetector& det, ROEdge* edge,
 			std::vector<ROEdge*>& seen, const GARDetectorCon& detectors) const;
 
+	/// @brief A route found from a source edge, to be added to the trip container
+	struct TripRoute {
+		GAREdge* pOrig;
+		GAREdge* pDest;
+		GARRouteDesc rd;
+	};
+
+	/// @brief The result of the route search from a source edge
+	struct SourceRoutes {
+		std::unique_ptr<GARRouteCont> pRouCont;
+		std::vector<TripRoute> tripRoutes;
+		std::vector<std::string> warnings;
+	};
+
+	/** @brief Searches the routes from a source edge
+	 *
+	 * The search only reads the network and the detectors, so the routes of several
+	 *  source edges can be searched concurrently. The trip routes and the warnings are
+	 *  collected in the order they are found, to be replayed by the caller.
+	 *
+	 * The partial routes are expanded fastest first. With the dominance pruning, a partial
+	 *  route is dropped if a faster one already went over the same edge and exactly the
+	 *  same detectors. The slowest live partial routes are dropped over the cap. The
+	 *  memory of the search is accounted against its own share of the budget in limits,
+	 *  so the routes found do not depend on the concurrent searches, and the arena grows
+	 *  in chunks bounded by the budget left. Once the budget is spent, the slowest live
+	 *  partial routes are evicted to make room for the new ones. The dropped partial
+	 *  routes are leaves of the tree, so their slots are recycled.
+	 */
 	void computeRoutesFor(ROEdge* edge,
 						  GARRouteDesc& base,
 						  const GARDetector& det,
 						  GARRouteCont& into,
-						  GARTripCont& tripCont,
+						  std::vector<TripRoute>& tripRoutes,
+						  std::vector<std::string>& warnings,
 						  const GARDetectorCon& detCont,
 						  const GARTazCont& tazCont,
 						  int maxFollowingLength,
+						  const RouteSearchLimits& limits,
 						  std::vector<ROEdge*>& seen,
 						  CLogger* logger) const;
 
@@ -170,41 +262,86 @@ protected:
 		ROEdge* edge;
 	};
 
-protected:
-	class DFRouteDescByTimeComperator {
-	public:
-		/// Constructor
-		explicit DFRouteDescByTimeComperator() {
-		}
-
-		/// Destructor
-		~DFRouteDescByTimeComperator() {
-		}
+	/// @brief The fewest nodes the path tree arena grows by, under the memory budget
+	static const size_t MIN_NODE_GROWTH = 64;
 
-		/// Comparing method
-		bool operator()(const GARRouteDesc& nod1,
-				const GARRouteDesc& nod2) const {
-			return nod1.duration_2 > nod2.duration_2;
-		}
+	/// @brief A node of the prefix tree of the partial routes searched from a source edge
+	struct PathNode {
+		ROEdge* edge;			/// @brief The last edge of the partial route
+		int32_t parent;			/// @brief The node of the route without its last edge, -1 at the root
+		uint64_t pathMask;		/// @brief The union of the mask bits of the route edges
+		uint64_t detectorSet;	/// @brief The sum of the hashes of the route edges carrying detectors
+		GARRouteDesc state;		/// @brief The route state, without the edges
 	};
 
+	/** @brief Builds the route of a path tree node, following the parents up to the root
+	 * @param[in] nodes The path tree
+	 * @param[in] n The node
+	 * @return The route, with its edges
+	 */
+	static GARRouteDesc materializeRoute(const std::vector<PathNode>& nodes, uint32_t n);
+
+	/** @brief Checks whether an edge is on the route of a path tree node
+	 *
+	 * The parents are only walked if the edge bit is in the path mask of the node.
+	 */
+	static bool isOnPath(const std::vector<PathNode>& nodes, uint32_t n, const ROEdge* edge);
+
+	/// @brief Gets the bit of an edge in the path masks
+	static uint64_t edgeBit(const ROEdge* edge);
+
+	/// @brief Gets the hash of an edge
+	static uint64_t edgeHash(const ROEdge* edge);
+
+	/// @brief Gets the key of the last edge and the detector set of a path tree node
+	static uint64_t dominanceKey(const PathNode& node);
+
 private:
-	/// @brief comparator for maps using edges as key, used only in myDetectorsOnEdges to make tests comparable
+	/// @brief comparator of edges by id, used only to sort myDetectorEdgeList to make tests comparable
 	struct idComp {
 		bool operator()(ROEdge* const lhs, ROEdge* const rhs) const {
 			return lhs->getID() < rhs->getID();
 		}
 	};
 
-	/// @brief Map of edge name->list of names of this edge approaching edges
-	std::map<ROEdge*, std::vector<ROEdge*> > myApproachingEdges;
+	/// @brief Packs the indices of a from and a to node into a single key
+	static uint64_t nodePairKey(uint32_t fromNodeIdx, uint32_t toNodeIdx);
+
+	/// @brief Gets the index of a node id, adding it if it is not indexed yet
+	uint32_t indexNode(const std::string& node) const;
+
+	/// @brief The start of the approaching edges of every edge in myApproachingEdges, indexed by the edge numerical id
+	std::vector<uint32_t> myApproachingOffsets;
+
+	/// @brief The edges approaching every edge, in compressed rows
+	std::vector<ROEdge*> myApproachingEdges;
+
+	/// @brief The start of the edges approached by every edge in myApproachedEdges, indexed by the edge numerical id
+	std::vector<uint32_t> myApproachedOffsets;
+
+	/// @brief The edges approached by every edge, in compressed rows
+	std::vector<ROEdge*> myApproachedEdges;
 
-	/// @brief Map of edge name->list of names of edges approached by this edge
-	std::map<ROEdge*, std::vector<ROEdge*> > myApproachedEdges;
+	/// @brief The start of the detectors of every edge in myDetectorIds, indexed by the edge numerical id
+	mutable std::vector<uint32_t> myDetectorOffsets;
+
+	/// @brief The ids of the detectors on every edge, in compressed rows
+	mutable std::vector<std::string> myDetectorIds;
+
+	/// @brief The edges carrying detectors, sorted by id
+	mutable std::vector<ROEdge*> myDetectorEdgeList;
 
-	mutable std::map<ROEdge*, std::vector<std::string>, idComp> myDetectorsOnEdges;
 	mutable std::map<std::string, ROEdge*> myDetectorEdges;
 
+	/// @brief Whether an edge carries detectors, indexed by the edge numerical id
+	mutable std::vector<bool> myDetectorEdgeBits;
+
+	/// @brief The indices of the nodes bounding the detector edges, by node id
+	mutable std::unordered_map<std::string, uint32_t> myNodeIndices;
+
+	/// @brief The detector edges by the packed indices of their from and to nodes
+	mutable std::unordered_map<uint64_t, const ROEdge*> myNodePairEdges;
+
 	bool myAmInHighwayMode;
 	mutable size_t mySourceNumber, mySinkNumber, myInBetweenNumber,
 			myInvalidNumber;
@@ -32,6 +32,8 @@
 
 #include <vector>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <utils/common/UtilExceptions.h>
 #include "GARRouteDesc.hpp"
 
@@ -55,6 +57,10 @@ class OutputDevice;
  *  edge pair "myConnectionOccurences" and the route is named using this
  *  information, @see addRouteDesc.
  *
+ * The routes are indexed by the hash of their edges and by their name, so
+ *  adding a route and looking it up take constant time. The stored routes
+ *  are only changed through the container, which keeps the indices valid.
+ *
  * @see GARRouteDesc
  */
 class GARRouteCont {
@@ -100,13 +106,28 @@ public:
 	bool save(std::vector<std::string>& saved, const std::string& prependix,
 			OutputDevice& out);
 
-	/** @brief Returns the container of stored routes
+	/** @brief Returns the container of stored routes (read-only)
 	 * @return The stored routes
 	 */
-	std::vector<GARRouteDesc>& get() {
+	const std::vector<GARRouteDesc>& get() const {
 		return myRoutes;
 	}
 
+	/** @brief Sets the overall probability of a stored route
+	 *
+	 * @param[in] route The index of the route
+	 * @param[in] prob The overall probability
+	 */
+	void setOverallProb(size_t route, SUMOReal prob);
+
+	/** @brief Adds the stored routes to another container
+	 *
+	 * The stored routes take the ids the other container gives them.
+	 *
+	 * @param[in, out] into The container to add the routes to
+	 */
+	void addRoutesTo(GARRouteCont& into);
+
 	/** @brief Sorts routes by their distance (length)
 	 *
 	 * Done using by_distance_sorter.
@@ -125,15 +146,13 @@ public:
 
 	/**
 	 * Get a pointer to the route description in the route container agreeing with
-	 * the specified route name.
+	 * the specified route name. The pointer is valid until a route is added or the
+	 * routes are reordered.
 	 * @param routeName	The name of the route.
-	 * @return			A pointer to the route description that matches the route name.
+	 * @return			A pointer to the route description that matches the route name,
+	 * 					<code>nullptr</code> if there is no such route.
 	 */
-	std::shared_ptr<const GARRouteDesc> getRouteDesc(const std::string& routeName) const;
-
-	/*
-	const GARRouteDesc const* getRouteDesc(const std::string& routeName) const;
-	*/
+	const GARRouteDesc* getRouteDesc(const std::string& routeName) const;
 
 protected:
 	/** @brief Computes and sets the id of a route
@@ -145,6 +164,23 @@ protected:
 	 */
 	void setID(GARRouteDesc& desc) const;
 
+	/** @brief Computes the hash of the edges of a route
+	 *
+	 * @param[in] edges The edges of the route
+	 * @return The hash of the edge sequence
+	 */
+	static size_t hashEdges(const std::vector<ROEdge*>& edges);
+
+	/** @brief Finds a same route (one that passes the same edges)
+	 *
+	 * @param[in] desc The route description to which a same shall be found
+	 * @return The index of the same route, the number of routes if there is none
+	 */
+	size_t findSame(const GARRouteDesc& desc) const;
+
+	/// @brief Rebuilds the route indices after the routes were reordered
+	void rebuildIndices();
+
 	/** @brief A class for sorting route descriptions by their length */
 	class by_distance_sorter {
 	public:
@@ -189,6 +225,12 @@ protected:
 	/// @brief Counts how many routes connecting the key-edges were already stored
 	mutable std::map<std::pair<ROEdge*, ROEdge*>, int> myConnectionOccurences;
 
+	/// @brief The indices of the stored routes by the hash of their edges
+	std::unordered_multimap<size_t, size_t> myEdgesIndex;
+
+	/// @brief The indices of the stored routes by their name
+	std::unordered_map<std::string, size_t> myNameIndex;
+
 };
 
 #endif
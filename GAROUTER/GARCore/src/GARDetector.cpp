@@ -185,16 +185,16 @@ GARDetector::buildDestinationDistribution(const GARDetectorCon& detectors,
         }
         return;
     }
-    std::vector<GARRouteDesc>& descs = myRoutes->get();
+    const std::vector<GARRouteDesc>& descs = myRoutes->get();
     // iterate through time (in output interval steps)
     for (SUMOTime time = startTime; time < endTime; time += stepOffset) {
         into[time] = new RandomDistributor<size_t>();
         std::map<ROEdge*, SUMOReal> flowMap;
         // iterate through the routes
         size_t index = 0;
-        for (std::vector<GARRouteDesc>::iterator ri = descs.begin(); ri != descs.end(); ++ri, index++) {
+        for (std::vector<GARRouteDesc>::const_iterator ri = descs.begin(); ri != descs.end(); ++ri, index++) {
             SUMOReal prob = 1.;
-            for (std::vector<ROEdge*>::iterator j = (*ri).edges2Pass.begin(); j != (*ri).edges2Pass.end() && prob > 0;) {
+            for (std::vector<ROEdge*>::const_iterator j = (*ri).edges2Pass.begin(); j != (*ri).edges2Pass.end() && prob > 0;) {
                 if (!net.hasDetector(*j)) {
                     ++j;
                     continue;
@@ -222,7 +222,7 @@ GARDetector::buildDestinationDistribution(const GARDetectorCon& detectors,
                 }
             }
             into[time]->add(prob, index);
-            (*ri).overallProb = prob;
+            myRoutes->setOverallProb(index, prob);
         }
     }
 }
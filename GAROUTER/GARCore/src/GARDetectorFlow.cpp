@@ -57,26 +57,11 @@ GARDetectorFlows::~GARDetectorFlows() {
 void GARDetectorFlows::addFlow(const std::string& id,
 							   SUMOTime t,
 							   const FlowDef& fd) {
-	if (myFastAccessFlows.find(id) == myFastAccessFlows.end()) {
-		size_t noItems = (size_t) ((myEndTime - myBeginTime) / myStepOffset);
-		myFastAccessFlows[id] = std::vector<FlowDef>(noItems);
-		std::vector<FlowDef>& cflows = myFastAccessFlows[id];
-		// initialise
-		for (std::vector<FlowDef>::iterator i = cflows.begin();
-				i < cflows.end(); ++i) {
-			(*i).qPKW = 0;
-			(*i).qLKW = 0;
-			(*i).vPKW = 0;
-			(*i).vLKW = 0;
-			(*i).fLKW = 0;
-			(*i).isLKW = 0;
-			(*i).firstSet = true;
-		}
-	}
+	std::vector<FlowDef>& cflows = getOrAddFlowDefs(id);
 
-	assert( (t - myBeginTime) / myStepOffset  <  (int) myFastAccessFlows[id].size() );
+	assert( (t - myBeginTime) / myStepOffset  <  (int) cflows.size() );
 
-	FlowDef& ofd = myFastAccessFlows[id][(t - myBeginTime) / myStepOffset];
+	FlowDef& ofd = cflows[(t - myBeginTime) / myStepOffset];
 	if (ofd.firstSet) {
 		ofd = fd;
 		ofd.firstSet = false;
@@ -123,6 +108,30 @@ GARDetectorFlows::getFlowDefs(const std::string& id) const {
 	return myFastAccessFlows.find(id)->second;
 }
 
+std::vector<FlowDef>&
+GARDetectorFlows::getOrAddFlowDefs(const std::string& id) {
+	flow_map::iterator it = myFastAccessFlows.find(id);
+	if (it != myFastAccessFlows.end()) {
+		return it->second;
+	}
+
+	size_t noItems = (size_t) ((myEndTime - myBeginTime) / myStepOffset);
+	std::vector<FlowDef>& cflows = myFastAccessFlows[id];
+	cflows.resize(noItems);
+	// initialise
+	for (std::vector<FlowDef>::iterator i = cflows.begin();
+			i < cflows.end(); ++i) {
+		(*i).qPKW = 0;
+		(*i).qLKW = 0;
+		(*i).vPKW = 0;
+		(*i).vLKW = 0;
+		(*i).fLKW = 0;
+		(*i).isLKW = 0;
+		(*i).firstSet = true;
+	}
+	return cflows;
+}
+
 SUMOReal GARDetectorFlows::getFlowSumSecure(const std::string& id) const {
 	SUMOReal ret = 0;
 	if (knows(id)) {
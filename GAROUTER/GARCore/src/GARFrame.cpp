@@ -162,6 +162,36 @@ void GARFrame::fillOptions() {
 			"The number of shortest routes to be considered as part of the chromosome alleles "
 			"of the genetic algorithm population.");
 
+	// To compute the shortest routes of the detector pairs concurrently
+	oc.doRegister("k-shortest-threads", new Option_Integer(1));
+	oc.addDescription("k-shortest-threads", "Processing",
+			"The number of threads computing the shortest routes of the source and sink detector pairs concurrently. "
+			"The routes do not depend on the number of threads. Default value: 1");
+
+	// To search the routes of the source detectors concurrently
+	oc.doRegister("route-threads", new Option_Integer(1));
+	oc.addDescription("route-threads", "Processing",
+			"The number of threads searching the routes from the source detector edges concurrently. "
+			"The routes and their ids do not depend on the number of threads. Default value: 1");
+
+	// To bound the route search from the source detectors
+	oc.doRegister("route-dominance", new Option_Bool(false));
+	oc.addDescription("route-dominance", "Processing",
+			"Prune a partial route from a source detector if a faster one already went over the same edge "
+			"and passed the same detectors. It keeps the route search from growing combinatorially on meshed networks. "
+			"Default value: false");
+
+	oc.doRegister("route-max-labels", new Option_Integer(0));
+	oc.addDescription("route-max-labels", "Processing",
+			"The number of live partial routes kept by the route search from a source detector. "
+			"The slowest ones are dropped over it. 0 for no limit. Default value: 0");
+
+	oc.doRegister("route-memory-budget", new Option_Integer(0));
+	oc.addDescription("route-memory-budget", "Processing",
+			"The megabytes the partial routes of all the route searches may take, split in equal shares between "
+			"the source detector edges. Once its share is spent, a search no longer grows: it goes on with the fastest "
+			"partial routes it holds. 0 for no limit. Default value: 0");
+
 	// For detector reading
 	oc.doRegister("ignore-invalid-detectors", new Option_Bool(false));
 	oc.addDescription("ignore-invalid-detectors", "Processing",
@@ -260,6 +290,65 @@ void GARFrame::fillOptions() {
 	oc.doRegister("meas-freq", new Option_Integer(10));
 	oc.addDescription("meas-freq", "Processing", "The measurement frequency in seconds");
 
+	oc.doRegister("sumo-binary", new Option_String("sumo"));
+	oc.addDescription("sumo-binary", "Processing", "The SUMO executable run by the dynamic approach. Default value: sumo");
+
+	oc.doRegister("sumo-workers", new Option_Integer(1));
+	oc.addDescription("sumo-workers", "Processing",
+			"The maximum number of SUMO simulations run concurrently by the dynamic approach. "
+			"Every worker runs its simulations in a private temporary directory. Default value: 1");
+
+	oc.doRegister("dyn-evaluator", new Option_String("sumo"));
+	oc.addDescription("dyn-evaluator", "Processing",
+			"The simulator evaluating the genomes of the dynamic approach: 'sumo' runs a SUMO simulation per genome, "
+			"'meso' runs the in-process mesoscopic queue simulator. Default value: sumo");
+
+	oc.doRegister("meso-headway", new Option_Float(2.));
+	oc.addDescription("meso-headway", "Processing",
+			"The saturation headway in seconds of a lane in the mesoscopic simulator. Default value: 2");
+
+	oc.doRegister("sumo-validation", new Option_Bool(false));
+	oc.addDescription("sumo-validation", "Processing",
+			"Validate the best genome of the mesoscopic dynamic approach with a SUMO simulation. Default value: false");
+
+	oc.doRegister("checkpoint-file", new Option_String("gar_checkpoint.bin"));
+	oc.addDescription("checkpoint-file", "Processing",
+			"The file keeping the checkpoint of the evolution: the population genomes and scores, the generation "
+			"and the seed of the run. It is overwritten at every checkpoint. Default value: gar_checkpoint.bin");
+
+	oc.doRegister("checkpoint-interval", new Option_Integer(0));
+	oc.addDescription("checkpoint-interval", "Processing",
+			"The number of generations between two checkpoints of the Simple, SteadyState and Incremental "
+			"genetic algorithms. 0 disables the checkpoints. Default value: 0");
+
+	oc.doRegister("resume", new Option_Bool(false));
+	oc.addDescription("resume", "Processing",
+			"Resume the evolution from the checkpoint file. A dynamic checkpoint skips the static evolution. "
+			"The resumed run goes on with the generation, statistics and best solutions of the interrupted one. "
+			"Every checkpoint generation reseeds the evolution from the run seed and the generation, so a resumed run "
+			"with the same 'checkpoint-interval' follows the same trajectory as an uninterrupted one. Default value: false");
+
+	oc.doRegister("incumbent-routes-output", new Option_FileName());
+	oc.addDescription("incumbent-routes-output", "Processing",
+			"Publishes the routes of the best static solution found so far to FILE, one route name and its trip count per line, "
+			"every 'incumbent-interval' seconds during the static evolution. The file is replaced at once");
+
+	oc.doRegister("incumbent-emitters-output", new Option_FileName());
+	oc.addDescription("incumbent-emitters-output", "Processing",
+			"Publishes the emitters of the best dynamic solution found so far to FILE "
+			"every 'incumbent-interval' seconds during the dynamic evolution. The file is replaced at once");
+
+	oc.doRegister("incumbent-interval", new Option_Float(60.));
+	oc.addDescription("incumbent-interval", "Processing",
+			"The seconds between two publications of the best solution found so far. Default value: 60");
+
+	oc.doRegister("sim-store", new Option_String(""));
+	oc.addDescription("sim-store", "Processing",
+			"The file persisting the detector counts simulated by the dynamic approach across runs, keyed by a hash of "
+			"the genes and a fingerprint of the network, routes, induction loops, goal flows and simulator settings. "
+			"A genome already simulated in the same scenario by any run is scored from the file. Empty disables the store. "
+			"Default value: empty");
+
 
 	//....................................................... Register the GA parameter options ...
 	// genetic algorithm type
@@ -267,11 +356,14 @@ void GARFrame::fillOptions() {
 	oc.doRegister("genetic-algorithm", new Option_String("Simple"));
 	oc.addDescription("genetic-algorithm", "GAParameters",
 			"The type of the genetic algorithm to be used. "
-			"Possible values: [Simple | SteadyState | Incremental | Deme]. "
+			"Possible values: [Simple | SteadyState | Incremental | Deme | Island | AsyncSteadyState]. "
 			"Simple (non-overlapping populations), "
 			"SteadyState (overlapping populations), "
 			"Incremental (overlapping with custom replacement), "
-			"Deme (parallel populations with migration)."
+			"Deme (parallel populations with migration), "
+			"Island (populations evolving concurrently on their own threads with migration). "
+			"AsyncSteadyState (overlapping populations whose children are evaluated asynchronously, "
+			"a new child being bred as soon as an evaluation completes). "
 			"Default value: Simple");
 	// seed
 	oc.doRegister("ga-seed", new Option_Integer());
@@ -383,6 +475,60 @@ void GARFrame::fillOptions() {
 			"Each population will migrate this many of its best individuals to the neighbor population "
 			"(the stepping-stone migration model). The worst individuals in the neighbor population are replaced. "
 			"Default value: 5");
+	// migration interval
+	oc.doRegister("migration-interval", new Option_Integer(10));
+	oc.addDescription("migration-interval", "GAParameters",
+			"The number of generations between two migrations of the Island genetic algorithm. "
+			"0 disables the migration. Default value: 10");
+	// migration topology
+	oc.doRegister("migration-topology", new Option_String("Ring"));
+	oc.addDescription("migration-topology", "GAParameters",
+			"The destination of the migrants of an island in the Island genetic algorithm. "
+			"Possible values: [Ring | Random]. Ring (the next island), Random (a random island every migration). "
+			"Default value: Ring");
+	// local search
+	oc.doRegister("local-search-elites", new Option_Integer(0));
+	oc.addDescription("local-search-elites", "GAParameters",
+			"The number of best individuals of every evaluated population of the static approach refined by a hill-climbing "
+			"local search that moves single trips to a better candidate route of their OD pair. "
+			"It applies to the trip genome of the Simple genetic algorithm, the only one evaluating its offspring as a whole population. "
+			"0 disables the local search. Default value: 0");
+	oc.doRegister("local-search-moves", new Option_Integer(50));
+	oc.addDescription("local-search-moves", "GAParameters",
+			"The number of moves the local search tries on every refined individual. Default value: 50");
+	// evaluation threads
+	oc.doRegister("evaluation-threads", new Option_Integer(1));
+	oc.addDescription("evaluation-threads", "GAParameters",
+			"The number of threads evaluating the individuals of the static approach population concurrently. "
+			"The scores do not depend on the number of threads. "
+			"Default value: 1");
+	// delta evaluation
+	oc.doRegister("delta-evaluation", new Option_Bool(true));
+	oc.addDescription("delta-evaluation", "GAParameters",
+			"Specify whether the genomes of the static approach are evaluated incrementally. "
+			"When it is on, every genome keeps the edge flow counts of its last evaluation, and only the genes "
+			"changed since then by the crossover and the mutation are processed. The scores are the same as in the full evaluation. "
+			"Possible values: true and false. "
+			"Default value: true");
+	// fitness cache
+	oc.doRegister("fitness-cache", new Option_Integer(0));
+	oc.addDescription("fitness-cache", "GAParameters",
+			"The maximum number of genome scores kept in memory per approach, keyed by a hash of the genes. "
+			"A genome whose genes were already evaluated gets the cached score instead of being evaluated again, "
+			"which saves a whole simulation in the dynamic approach. The oldest scores are evicted when the cache is full. "
+			"The cache hits and misses are reported at the end of the evolution. 0 disables the cache. "
+			"Default value: 0");
+	// static genome encoding
+	oc.doRegister("static-encoding", new Option_String("trip"));
+	oc.addDescription("static-encoding", "GAParameters",
+			"The encoding of the static approach genome. "
+			"trip: one gene per trip, holding the route of the vehicle, "
+			"count: one gene per candidate route of every OD pair, holding the number of trips of the OD pair assigned to the route. "
+			"The count encoding scales with the number of routes instead of the number of vehicles. It has its own "
+			"initialization, mutation and crossover operators, which keep the trip total of every OD pair, so the "
+			"'genome-initializer', 'genome-mutator', 'genome-crossover' and 'delta-evaluation' options do not apply to it. "
+			"Valid values: [trip | count]. "
+			"Default value: trip");
 	// initialization operator
 	oc.doRegister("genome-initializer", new Option_String("Uniform"));
 	oc.addDescription("genome-initializer", "GAParameters",
@@ -402,9 +548,11 @@ void GARFrame::fillOptions() {
 			"The mutation operator. The mutation operator defines the procedure for mutating each genome. "
 			"In general, you should define a mutation that can do both exploration and exploitation; "
 			"mutation should be able to introduce new genetic material as well as modify existing material. "
-			"Valid mutation operators: [Flip | Swap]. "
+			"Valid mutation operators: [Flip | Swap | Residual]. "
 			"Flip: randomly pick elements in the array then set the element to any of the alleles in the allele set for this genome, "
-			"Swap: swaps the value of one element of the genome for the value of other element with a given probability. "
+			"Swap: swaps the value of one element of the genome for the value of other element with a given probability, "
+			"Residual: move the trips whose routes cross over-counted edges to the candidate route of the same OD pair reducing the "
+			"edge flow error the most. It only applies to the static approach; the dynamic approach uses Flip instead. "
 			"Default value: Flip");
 	// crossover operator
 	oc.doRegister("genome-crossover", new Option_String("OnePoint"));
@@ -508,8 +656,27 @@ void GARFrame::fillOptions() {
 			" The genetic algorithm will always run at least this many generations."
 			"UponPopConvergence: This function compares the population average to the score of the best individual in the population."
 			" If the population average is within pConvergence of the best individual's score, it returns gaTrue. Otherwise, it returns gaFalse. "
-			"Possible values: [UponGeneration | UponConvergence | UponPopConvergence]. "
+			"UponBudget: This function stops the evolution at the requested number of generations, when the time budget is spent,"
+			" or when the best score has not improved by the minimum improvement for the stall generations. "
+			"Possible values: [UponGeneration | UponConvergence | UponPopConvergence | UponBudget]. "
 			"Default value: UponGeneration");
+	// time budget
+	oc.doRegister("time-budget", new Option_Float(0.));
+	oc.addDescription("time-budget", "GAParameters",
+			"The wall-clock seconds the UponBudget termination function grants to the whole evolution, the static and dynamic "
+			"approaches together, from the start of the first one. The individuals not yet evaluated at the deadline "
+			"take the worst score of their population, so the running generation completes without evaluating them. "
+			"0 disables the deadline. Default value: 0");
+	// stall generations
+	oc.doRegister("stall-generations", new Option_Integer(0));
+	oc.addDescription("stall-generations", "GAParameters",
+			"The number of generations without improvement of the best score after which the UponBudget termination function "
+			"stops the evolution. 0 disables the stall detection. Default value: 0");
+	// minimum improvement
+	oc.doRegister("min-improvement", new Option_Float(0.));
+	oc.addDescription("min-improvement", "GAParameters",
+			"The smallest change of the best score the UponBudget termination function counts as an improvement. "
+			"Default value: 0");
 	// replacement scheme
 	oc.doRegister("replacement-scheme", new Option_String("Random"));
 	oc.addDescription("replacement-scheme", "GAParameters",
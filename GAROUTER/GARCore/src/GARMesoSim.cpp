@@ -0,0 +1,280 @@
+/*
+ * GARMesoSim.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARMesoSim.hpp>
+#include <router/ROEdge.h>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+using std::string;
+using std::vector;
+using std::shared_ptr;
+using std::unordered_map;
+
+namespace gar {
+
+namespace {
+
+/**
+ * A vehicle reaching the downstream end of its current edge.
+ */
+struct MesoEvent {
+	//! The event time
+	double time;
+
+	//! The vehicle index
+	uint32_t vehicle;
+
+	bool operator>(const MesoEvent& rhs) const {
+		return (time > rhs.time) || (time == rhs.time && vehicle > rhs.vehicle);
+	}
+};
+
+//! The lowest speed a vehicle runs along an edge, to avoid endless traversals
+const SUMOReal GAR_MESO_MIN_SPEED = 0.1;
+
+}
+
+
+//................................................. Parameterized constructor ...
+GARMesoSim::GARMesoSim(const GARRouteCont const* pRouCont,
+					   const GARDetectorCon const* pDetCont,
+					   const SUMOTime& begin,
+					   const SUMOTime& end,
+					   const SUMOTime& timeStep)
+: edges        (vector<MesoEdge>()),
+  edgeIndices  (unordered_map<string, uint32_t>()),
+  routes       (vector<MesoRoute>()),
+  routeIndices (unordered_map<string, uint32_t>()),
+  detectorIds  (vector<string>()),
+  begin        (begin),
+  end          (end),
+  timeStep     (timeStep),
+  numSteps     ((end + timeStep - begin) / timeStep),
+  headway      (2.0) {
+	// Compile the routes into edge index sequences
+	for (const GARRouteDesc& rd : pRouCont->get()) {
+		if (rd.edges2Pass.empty() || routeIndices.count(rd.routename) > 0) {
+			continue;
+		}
+
+		// The emitters depart at a detector of the first edge, as the SUMO emitters do
+		MesoRoute route;
+		route.departPos = 0.;
+		try {
+			const GARDetector& departDet = pDetCont->getAnyDetectorForEdge(static_cast<const GAREdge*>(rd.edges2Pass.front()));
+			route.departPos = std::max<SUMOReal>(departDet.getPos(), 0.);
+		} catch (int) {
+			// No detector on the first edge: depart at its beginning
+		}
+		for (const ROEdge const* pEdge : rd.edges2Pass) {
+			route.edges.push_back(addEdge(pEdge));
+		}
+
+		routeIndices.insert(std::make_pair(rd.routename, uint32_t(routes.size())));
+		routes.push_back(route);
+	}
+
+	// Place the detectors on the simulated edges, grouping them by lane
+	vector<unordered_map<string, uint32_t>> laneGroups(edges.size());
+	for (const GARDetector const* pDet : pDetCont->getDetectors()) {
+		uint32_t detector = detectorIds.size();
+		detectorIds.push_back(pDet->getID());
+
+		auto it = edgeIndices.find(pDet->getEdgeID());
+		if (it == edgeIndices.end()) {
+			continue;
+		}
+
+		unordered_map<string, uint32_t>& lanes = laneGroups[it->second];
+		auto lane = lanes.insert(std::make_pair(pDet->getLaneID(), uint32_t(lanes.size()))).first;
+
+		// The first lane of an edge is the lane 0 of SUMO
+		if (pDet->getLaneID() == pDet->getEdgeID() + "_0") {
+			edges[it->second].firstLane = lane->second;
+		}
+
+		MesoDetector det;
+		det.pos      = pDet->getPos();
+		det.lane     = lane->second;
+		det.detector = detector;
+		edges[it->second].detectors.push_back(det);
+	}
+
+	for (uint32_t e = 0; e < edges.size(); e++) {
+		MesoEdge& edge = edges[e];
+		edge.numDetLanes = std::max<uint32_t>(laneGroups[e].size(), 1);
+		if (edge.firstLane == std::numeric_limits<uint32_t>::max()) {
+			edge.firstLane = edge.numDetLanes;
+		}
+		std::stable_sort(edge.detectors.begin(), edge.detectors.end(),
+						 [] (const MesoDetector& a, const MesoDetector& b) { return a.pos < b.pos; });
+	}
+}
+
+
+//................................................. Get the saturation headway ...
+SUMOReal GARMesoSim::getHeadway(void) const {
+	return this->headway;
+}
+
+
+//................................................. Set the saturation headway ...
+void GARMesoSim::setHeadway(const SUMOReal& headway) {
+	this->headway = headway;
+}
+
+
+//................................................. Simulate the vehicles ...
+shared_ptr<GARDetectorFlows> GARMesoSim::simulate(const vector<string>& routeNames,
+												  const vector<int>& departs) const {
+	const size_t numVehicles = std::min(routeNames.size(), departs.size());
+	const double horizon = begin + double(numSteps) * timeStep;
+
+	vector<uint32_t> counts(detectorIds.size() * numSteps, 0);
+	vector<double> speeds(detectorIds.size() * numSteps, 0.);
+
+	// The time every edge can discharge its next vehicle
+	vector<double> nextFree(edges.size(), -std::numeric_limits<double>::infinity());
+
+	// The route and the current route edge of every vehicle
+	vector<uint32_t> vehRoute(numVehicles, 0);
+	vector<uint32_t> vehStep(numVehicles, 0);
+
+	std::priority_queue<MesoEvent, vector<MesoEvent>, std::greater<MesoEvent>> events;
+
+	// Insert the vehicles on their first edge
+	for (size_t i = 0; i < numVehicles; i++) {
+		if (routeNames[i].empty()) {
+			continue;
+		}
+
+		auto it = routeIndices.find(routeNames[i]);
+		if (it == routeIndices.end()) {
+			return nullptr;
+		}
+		vehRoute[i] = it->second;
+
+		const MesoRoute& route = routes[it->second];
+		const MesoEdge& edge = edges[route.edges.front()];
+		SUMOReal speed = std::max(edge.speed, GAR_MESO_MIN_SPEED);
+
+		// The vehicles depart on the first lane
+		countDetectors(edge, edge.firstLane, departs[i], route.departPos, counts, speeds);
+
+		MesoEvent event;
+		event.time    = departs[i] + std::max<SUMOReal>(edge.length - route.departPos, 0.) / speed;
+		event.vehicle = i;
+		events.push(event);
+	}
+
+	// Move the vehicles through the edge queues in time order
+	while (!events.empty()) {
+		MesoEvent event = events.top();
+		events.pop();
+
+		// Nothing is counted after the last time step
+		if (event.time >= horizon) {
+			continue;
+		}
+
+		const MesoRoute& route = routes[vehRoute[event.vehicle]];
+		uint32_t e = route.edges[vehStep[event.vehicle]];
+
+		// Wait at the downstream end until the edge discharges the vehicle
+		double exitTime = std::max(event.time, nextFree[e]);
+		nextFree[e] = exitTime + headway / edges[e].numLanes;
+
+		// The vehicle arrives at the end of its route
+		if (++vehStep[event.vehicle] == route.edges.size()) {
+			continue;
+		}
+
+		const MesoEdge& next = edges[route.edges[vehStep[event.vehicle]]];
+		countDetectors(next, event.vehicle % next.numDetLanes, exitTime, 0., counts, speeds);
+
+		event.time = exitTime + next.length / std::max(next.speed, GAR_MESO_MIN_SPEED);
+		events.push(event);
+	}
+
+	// Build the detector flows
+	shared_ptr<GARDetectorFlows> pDetFlows = std::make_shared<GARDetectorFlows>(begin, end, timeStep);
+	for (uint32_t d = 0; d < detectorIds.size(); d++) {
+		vector<FlowDef> flows(numSteps);
+		for (uint32_t s = 0; s < numSteps; s++) {
+			uint32_t count = counts[d * numSteps + s];
+
+			FlowDef& fd = flows[s];
+			fd.qPKW  = count;
+			fd.vPKW  = (count > 0) ? SUMOReal(speeds[d * numSteps + s] / count) : -1.;
+			fd.qLKW  = 0.0;
+			fd.vLKW  = 0.0;
+			fd.isLKW = 0.0;
+			fd.fLKW  = 0.0;
+			fd.firstSet = false;
+		}
+		pDetFlows->setFlows(detectorIds[d], flows);
+	}
+
+	return pDetFlows;
+}
+
+
+//................................................. Add a simulated edge ...
+uint32_t GARMesoSim::addEdge(const ROEdge const* pEdge) {
+	auto it = edgeIndices.find(pEdge->getID());
+	if (it != edgeIndices.end()) {
+		return it->second;
+	}
+
+	MesoEdge edge;
+	edge.length      = pEdge->getLength();
+	edge.speed       = pEdge->getSpeed();
+	edge.numLanes    = std::max<uint32_t>(pEdge->getLaneNo(), 1);
+	edge.numDetLanes = 1;
+	edge.firstLane   = std::numeric_limits<uint32_t>::max();
+
+	uint32_t index = edges.size();
+	edges.push_back(edge);
+	edgeIndices.insert(std::make_pair(pEdge->getID(), index));
+
+	return index;
+}
+
+
+//................................................. Count a vehicle at the detectors of an edge ...
+void GARMesoSim::countDetectors(const MesoEdge& edge,
+								uint32_t lane,
+								double entryTime,
+								SUMOReal entryPos,
+								vector<uint32_t>& counts,
+								vector<double>& speeds) const {
+	SUMOReal speed = std::max(edge.speed, GAR_MESO_MIN_SPEED);
+
+	for (const MesoDetector& det : edge.detectors) {
+		if (det.pos < entryPos || det.lane != lane) {
+			continue;
+		}
+
+		double time = entryTime + (det.pos - entryPos) / speed;
+		if (time < begin) {
+			continue;
+		}
+
+		uint32_t step = (time - begin) / timeStep;
+		if (step >= numSteps) {
+			return;
+		}
+
+		counts[det.detector * numSteps + step]++;
+		speeds[det.detector * numSteps + step] += speed;
+	}
+}
+
+} /* namespace gar */
@@ -34,6 +34,8 @@
 #include <map>
 #include <vector>
 #include <iterator>
+#include <queue>
+#include <unordered_map>
 #include "GARNet.hpp"
 #include "GARDetector.hpp"
 #include "GARRouteDesc.hpp"
@@ -46,6 +48,8 @@
 #include <utils/common/ToString.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/geom/GeomHelper.h>
+#include <ThreadPool.hpp>
+#include <algorithm>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -77,10 +81,14 @@ GARNet::~GARNet(void) {
 }
 
 void GARNet::buildApproachList() {
+	// collect the connections ce->help in the order of the edge ids
+	std::vector<std::pair<ROEdge*, ROEdge*> > connections;
+	size_t numIds = 0;
 	const std::map<std::string, ROEdge*>& edges = getEdgeMap();
 	for (std::map<std::string, ROEdge*>::const_iterator rit = edges.begin();
 			rit != edges.end(); ++rit) {
 		ROEdge* ce = (*rit).second;
+		numIds = std::max(numIds, size_t(ce->getNumericalID()) + 1);
 		unsigned int i = 0;
 		unsigned int length_size = ce->getNumSuccessors();
 		for (i = 0; i < length_size; i++) {
@@ -94,19 +102,33 @@ void GARNet::buildApproachList() {
 				// do not use turnarounds
 				continue;
 			}
-			// add the connection help->ce to myApproachingEdges
-			if (myApproachingEdges.find(help) == myApproachingEdges.end()) {
-				myApproachingEdges[help] = std::vector<ROEdge*>();
-			}
-			myApproachingEdges[help].push_back(ce);
-
-			// add the connection ce->help to myApproachedEdges
-			if (myApproachedEdges.find(ce) == myApproachedEdges.end()) {
-				myApproachedEdges[ce] = std::vector<ROEdge*>();
-			}
-			myApproachedEdges[ce].push_back(help);
+			numIds = std::max(numIds, size_t(help->getNumericalID()) + 1);
+			connections.push_back(std::make_pair(ce, help));
 		}
 	}
+
+	// lay the lists out in compressed rows indexed by the edge numerical id,
+	//  keeping the connections of an edge in the order they were collected
+	auto buildRows = [&] (bool approaching, std::vector<uint32_t>& offsets, std::vector<ROEdge*>& rows) {
+		offsets.assign(numIds + 1, 0);
+		for (size_t c = 0; c < connections.size(); c++) {
+			ROEdge* key = approaching ? connections[c].second : connections[c].first;
+			offsets[key->getNumericalID() + 1]++;
+		}
+		for (size_t id = 0; id < numIds; id++) {
+			offsets[id + 1] += offsets[id];
+		}
+		std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+		rows.resize(connections.size());
+		for (size_t c = 0; c < connections.size(); c++) {
+			ROEdge* key = approaching ? connections[c].second : connections[c].first;
+			rows[next[key->getNumericalID()]++] = approaching ? connections[c].first : connections[c].second;
+		}
+	};
+
+	// the connection help->ce goes to myApproachingEdges, ce->help to myApproachedEdges
+	buildRows(true, myApproachingOffsets, myApproachingEdges);
+	buildRows(false, myApproachedOffsets, myApproachedEdges);
 }
 
 
@@ -127,15 +149,52 @@ void GARNet::buildNodeList(void) {
 
 
 void GARNet::buildDetectorEdgeDependencies(GARDetectorCon& detcont) const {
-	myDetectorsOnEdges.clear();
 	myDetectorEdges.clear();
+	myDetectorEdgeList.clear();
 	const std::vector<GARDetector*>& dets = detcont.getDetectors();
+	std::vector<ROEdge*> edges;
+	size_t numIds = getEdgeNo();
 	for (std::vector<GARDetector*>::const_iterator i = dets.begin();
 			i != dets.end(); ++i) {
 		ROEdge* e = getDetectorEdge(**i);
-		myDetectorsOnEdges[e].push_back((*i)->getID());
+		edges.push_back(e);
+		numIds = std::max(numIds, size_t(e->getNumericalID()) + 1);
 		myDetectorEdges[(*i)->getID()] = e;
 	}
+
+	// lay the detector ids out in compressed rows indexed by the edge numerical id,
+	//  keeping the detectors of an edge in the container order
+	myDetectorOffsets.assign(numIds + 1, 0);
+	for (size_t d = 0; d < edges.size(); d++) {
+		if (myDetectorOffsets[edges[d]->getNumericalID() + 1]++ == 0) {
+			myDetectorEdgeList.push_back(edges[d]);
+		}
+	}
+	for (size_t id = 0; id < numIds; id++) {
+		myDetectorOffsets[id + 1] += myDetectorOffsets[id];
+	}
+	std::vector<uint32_t> next(myDetectorOffsets.begin(), myDetectorOffsets.end() - 1);
+	myDetectorIds.resize(edges.size());
+	for (size_t d = 0; d < edges.size(); d++) {
+		myDetectorIds[next[edges[d]->getNumericalID()]++] = dets[d]->getID();
+	}
+	std::sort(myDetectorEdgeList.begin(), myDetectorEdgeList.end(), idComp());
+
+	// index the detector edges by their numerical id and by their nodes
+	myDetectorEdgeBits.assign(getEdgeNo(), false);
+	myNodeIndices.clear();
+	myNodePairEdges.clear();
+	for (std::map<std::string, ROEdge*>::const_iterator i = myDetectorEdges.begin();
+			i != myDetectorEdges.end(); ++i) {
+		ROEdge* e = i->second;
+		if (e->getNumericalID() >= myDetectorEdgeBits.size()) {
+			myDetectorEdgeBits.resize(e->getNumericalID() + 1, false);
+		}
+		myDetectorEdgeBits[e->getNumericalID()] = true;
+		myNodePairEdges.insert(std::make_pair(
+				nodePairKey(indexNode(e->getFromNode()->getID()),
+							indexNode(e->getToNode()->getID())), e));
+	}
 }
 
 void GARNet::computeTypes(GARDetectorCon& detcont, bool sourcesStrict) const {
@@ -179,11 +238,9 @@ void GARNet::computeTypes(GARDetectorCon& detcont, bool sourcesStrict) const {
 
 bool GARNet::hasInBetweenDetectorsOnly(ROEdge* edge,
 		const GARDetectorCon& detectors) const {
-	assert(myDetectorsOnEdges.find(edge) != myDetectorsOnEdges.end());
-	const std::vector<std::string>& detIDs =
-			myDetectorsOnEdges.find(edge)->second;
-	std::vector<std::string>::const_iterator i;
-	for (i = detIDs.begin(); i != detIDs.end(); ++i) {
+	assert(hasDetector(edge));
+	const DetectorSpan detIDs = getDetectorList(edge);
+	for (DetectorSpan::iterator i = detIDs.begin(); i != detIDs.end(); ++i) {
 		const GARDetector& det = detectors.getDetector(*i);
 		if (det.getType() != BETWEEN_DETECTOR) {
 			return false;
@@ -194,11 +251,9 @@ bool GARNet::hasInBetweenDetectorsOnly(ROEdge* edge,
 
 bool GARNet::hasSourceDetector(ROEdge* edge,
 		const GARDetectorCon& detectors) const {
-	assert(myDetectorsOnEdges.find(edge) != myDetectorsOnEdges.end());
-	const std::vector<std::string>& detIDs =
-			myDetectorsOnEdges.find(edge)->second;
-	std::vector<std::string>::const_iterator i;
-	for (i = detIDs.begin(); i != detIDs.end(); ++i) {
+	assert(hasDetector(edge));
+	const DetectorSpan detIDs = getDetectorList(edge);
+	for (DetectorSpan::iterator i = detIDs.begin(); i != detIDs.end(); ++i) {
 		const GARDetector& det = detectors.getDetector(*i);
 		if (det.getType() == SOURCE_DETECTOR) {
 			return true;
@@ -211,74 +266,208 @@ void GARNet::computeRoutesFor(ROEdge* edge,
 							  GARRouteDesc& base,
 							  const GARDetector& det,
 							  GARRouteCont& into,
-							  GARTripCont& tripCont,
+							  std::vector<TripRoute>& tripRoutes,
+							  std::vector<std::string>& warnings,
 							  const GARDetectorCon& detCont,
 							  const GARTazCont& tazCont,
 							  int maxFollowingLength,
+							  const RouteSearchLimits& limits,
 							  std::vector<ROEdge*>& seen,
 							  CLogger* logger) const {
-	std::vector<GARRouteDesc> unfoundEnds;
-	std::priority_queue<GARRouteDesc, std::vector<GARRouteDesc>, DFRouteDescByTimeComperator> toSolve;
-	std::map<ROEdge*, std::vector<ROEdge*>> dets2Follow;
-	dets2Follow[edge] = std::vector<ROEdge*>();
+	// The partial routes are nodes of a prefix tree: every node keeps its last edge, its parent
+	// and the route state, and the edges are only materialised for the routes accepted
+	std::vector<PathNode> nodes;
+	nodes.reserve(1024);
+
+	// The live partial routes, a heap of nodes with the fastest on top
+	auto byDuration = [&nodes] (uint32_t lhs, uint32_t rhs) {
+		return nodes[lhs].state.duration_2 > nodes[rhs].state.duration_2;
+	};
+	std::vector<uint32_t> toSolve;
+	std::vector<uint32_t> unfoundEnds;
+
+	// The leaves dropped from the tree, whose slots are taken by the next nodes
+	std::vector<uint32_t> freeNodes;
+
+	// The nodes already expanded, by the key of their last edge and detector set
+	std::unordered_map<uint64_t, std::vector<uint32_t> > settled;
+	size_t numSettled = 0;
+	std::vector<const ROEdge*> candidateDets;
+	std::vector<const ROEdge*> settledDets;
+	size_t numDominated = 0;
+	size_t numDropped = 0;
+	bool overBudget = false;
+
+	// The bytes of the routes found, in the route container and the trip routes
+	size_t routeBytes = 0;
+
 	base.passedNo = 0;
 	SUMOReal minDist = OptionsCont::getOptions().getFloat("min-route-length");
-	toSolve.push(base);
+	ROEdge* detEdge = getDetectorEdge(det);
+	ROEdge* first = base.edges2Pass.front();
+
+	// The root of the tree is the chain of the base route edges
+	for (ROEdge* baseEdge : base.edges2Pass) {
+		PathNode node;
+		node.edge = baseEdge;
+		node.parent = nodes.empty() ? -1 : int32_t(nodes.size() - 1);
+		node.pathMask = (nodes.empty() ? 0 : nodes.back().pathMask) | edgeBit(baseEdge);
+		node.detectorSet = (nodes.empty() ? 0 : nodes.back().detectorSet) + (hasDetector(baseEdge) ? edgeHash(baseEdge) : 0);
+		nodes.push_back(node);
+	}
+	nodes.back().state = base;
+	nodes.back().state.edges2Pass.clear();
+	toSolve.push_back(nodes.size() - 1);
 
 	// Get the TAZ of the source edge
 	shared_ptr<const GARTazGroup> pSourceGroup = tazCont.findSourceEdgeGroup(edge->getID());
 
-	while (!toSolve.empty()) {
-		GARRouteDesc current = toSolve.top();
-		toSolve.pop();
-		ROEdge* last = *(current.edges2Pass.end() - 1);
-		if (hasDetector(last)) {
-			if (dets2Follow.find(last) == dets2Follow.end()) {
-				dets2Follow[last] = std::vector<ROEdge*>();
+	// Account the memory of every structure the search grows against the budget of the search
+	size_t accounted = 0;
+	auto account = [&] (void) {
+		accounted = nodes.capacity() * sizeof(PathNode)
+				+ (toSolve.capacity() + unfoundEnds.capacity() + freeNodes.capacity() + numSettled) * sizeof(uint32_t)
+				+ settled.bucket_count() * sizeof(void*)
+				+ settled.size() * (sizeof(std::pair<const uint64_t, std::vector<uint32_t> >) + sizeof(void*))
+				+ seen.capacity() * sizeof(ROEdge*)
+				+ routeBytes;
+	};
+	account();
+
+	// Accept the route of a node
+	auto acceptRoute = [&] (uint32_t n, ROEdge* last) {
+		SUMOReal cdist = first->getFromNode()->getPosition().distanceTo(last->getToNode()->getPosition());
+		if (minDist < cdist) {
+			GARRouteDesc route = materializeRoute(nodes, n);
+			std::vector<GARRouteDesc>::iterator it = into.addRouteDesc(route);
+			if (logger->isDebugEnabled()) {
+				logger->debug("\tAdd route [" + route.routename + "]");
 			}
-			for (std::vector<ROEdge*>::reverse_iterator i =
-					current.edges2Pass.rbegin() + 1;
-					i != current.edges2Pass.rend(); ++i) {
-				if (hasDetector(*i)) {
-					dets2Follow[*i].push_back(last);
-					break;
+			tripRoutes.push_back(TripRoute { dynamic_cast<GAREdge*>(edge), dynamic_cast<GAREdge*>(last), *it });
+			routeBytes += 2 * (sizeof(TripRoute) + route.edges2Pass.size() * sizeof(ROEdge*));
+		}
+	};
+
+	// Drop the slowest live partial routes, keeping the fastest ones. The dropped nodes
+	// were never expanded, so they are leaves and their slots are recycled.
+	auto dropSlowest = [&] (size_t keep) {
+		auto faster = [&nodes] (uint32_t lhs, uint32_t rhs) {
+			return nodes[lhs].state.duration_2 < nodes[rhs].state.duration_2
+					|| (nodes[lhs].state.duration_2 == nodes[rhs].state.duration_2 && lhs < rhs);
+		};
+		std::nth_element(toSolve.begin(), toSolve.begin() + keep, toSolve.end(), faster);
+		numDropped += toSolve.size() - keep;
+		freeNodes.insert(freeNodes.end(), toSolve.begin() + keep, toSolve.end());
+		toSolve.resize(keep);
+		std::make_heap(toSolve.begin(), toSolve.end(), byDuration);
+	};
+
+	// Get a slot for a new node. The arena grows in chunks bounded by the memory budget left.
+	// Once the budget is spent, the slowest quarter of the live partial routes is evicted.
+	auto allocNode = [&] (void) -> int64_t {
+		if (freeNodes.empty() && nodes.size() == nodes.capacity()) {
+			size_t growth = nodes.capacity();
+			if (limits.memoryBudget > 0) {
+				size_t left = (accounted < limits.memoryBudget) ? limits.memoryBudget - accounted : 0;
+				growth = std::min(growth, left / sizeof(PathNode));
+			}
+			if (growth >= MIN_NODE_GROWTH) {
+				nodes.reserve(nodes.capacity() + growth);
+				account();
+			} else {
+				overBudget = true;
+				if (!toSolve.empty()) {
+					dropSlowest(toSolve.size() - (toSolve.size() + 3) / 4);
 				}
 			}
 		}
+		if (!freeNodes.empty()) {
+			uint32_t slot = freeNodes.back();
+			freeNodes.pop_back();
+			return slot;
+		}
+		if (nodes.size() < nodes.capacity()) {
+			nodes.push_back(PathNode());
+			return int64_t(nodes.size() - 1);
+		}
+		return -1;
+	};
+
+	// Collect the sorted detector edges of the route of a node followed by an edge
+	auto detectorEdges = [&] (int32_t n, const ROEdge* next, std::vector<const ROEdge*>& dets) {
+		dets.clear();
+		if (hasDetector(const_cast<ROEdge*>(next))) {
+			dets.push_back(next);
+		}
+		for (; n >= 0; n = nodes[n].parent) {
+			if (hasDetector(nodes[n].edge)) {
+				dets.push_back(nodes[n].edge);
+			}
+		}
+		std::sort(dets.begin(), dets.end());
+	};
+
+	// Check whether a node already expanded ends on the same edge and passes exactly the same
+	// detectors than the route of a node followed by an edge. It was expanded first, so it is faster.
+	auto isDominated = [&] (uint64_t key, int32_t parent, const ROEdge* last) {
+		std::unordered_map<uint64_t, std::vector<uint32_t> >::const_iterator it = settled.find(key);
+		if (it == settled.end()) {
+			return false;
+		}
+		detectorEdges(parent, last, candidateDets);
+		for (uint32_t s : it->second) {
+			if (nodes[s].edge != last) {
+				continue;
+			}
+			detectorEdges(nodes[s].parent, nodes[s].edge, settledDets);
+			if (settledDets == candidateDets) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	while (!toSolve.empty()) {
+		std::pop_heap(toSolve.begin(), toSolve.end(), byDuration);
+		uint32_t n = toSolve.back();
+		toSolve.pop_back();
+		ROEdge* last = nodes[n].edge;
+
+		// A faster partial route already went over the same edge and detectors
+		if (limits.dominance) {
+			uint64_t key = dominanceKey(nodes[n]);
+			if (isDominated(key, nodes[n].parent, last)) {
+				numDominated++;
+				freeNodes.push_back(n);
+				continue;
+			}
+			settled[key].push_back(n);
+			numSettled++;
+		}
 
 		seen.push_back(last);
 
 		// end if the edge has no further connections
 		if (!hasApproached(last)) {
 			// ok, no further connections to follow
-			current.factor = 1.;
-			SUMOReal cdist = current.edges2Pass[0]->getFromNode()->getPosition().
-								distanceTo(current.edges2Pass.back()->getToNode()->getPosition());
+			nodes[n].state.factor = 1.;
 
 			// Refuse sink edges in the same group than the source edge
 			if (tazCont.findSinkEdgeGroup(last->getID()) == pSourceGroup) {
-				//logger->info("Refuse route from source [" + edge->getID()
-				//		+ "] to sink [" + last->getID()
-				//		+ "] belonging to the same TAZ group [" + pEdgeGroup->getId() + "]");
 				continue;
 			}
 
-			if (minDist < cdist) {
-				std::vector<GARRouteDesc>::iterator it = into.addRouteDesc(current);
-				logger->debug("\tAdd route [" + current.routename + "]");
-				tripCont.addRouteDesc(dynamic_cast<GAREdge*>(edge),
-									  dynamic_cast<GAREdge*>(last),
-									  *it);
-			}
+			acceptRoute(n, last);
 			continue;
 		}
 
 		// check for passing detectors:
 		//  if the current last edge is not the one the detector is placed on ...
 		bool addNextNoFurther = false;
-		if (last != getDetectorEdge(det)) {
+		if (last != detEdge) {
 			// ... if there is a detector ...
 			if (hasDetector(last)) {
+				GARRouteDesc& current = nodes[n].state;
 				if (!hasInBetweenDetectorsOnly(last, detCont)) {
 					// ... and it's not an in-between-detector
 					// -> let's add this edge and the following, but not any further
@@ -287,19 +476,8 @@ void GARNet::computeRoutesFor(ROEdge* edge,
 					current.duration2Last = (SUMOTime) current.duration_2;
 					current.distance2Last = current.distance;
 					current.endDetectorEdge = last;
-					if (hasSourceDetector(last, detCont)) {
-///!!!                        //toDiscard.push_back(current);
-					}
 					current.factor = 1.;
-					SUMOReal cdist =
-							current.edges2Pass[0]->getFromNode()->getPosition().distanceTo(
-									current.edges2Pass.back()->getToNode()->getPosition());
-					if (minDist < cdist) {
-						std::vector<GARRouteDesc>::iterator it = into.addRouteDesc(current);
-						tripCont.addRouteDesc(dynamic_cast<GAREdge*>(edge),
-											  dynamic_cast<GAREdge*>(last),
-											  *it);
-					}
+					acceptRoute(n, last);
 					continue;
 				} else {
 					// ... if it's an in-between-detector
@@ -314,9 +492,9 @@ void GARNet::computeRoutesFor(ROEdge* edge,
 		// check for highway off-ramps
 		if (myAmInHighwayMode) {
 			// if it's beside the highway...
-			if (last->getSpeed() < 19.4 && last != getDetectorEdge(det)) {
+			if (last->getSpeed() < 19.4 && last != detEdge) {
 				// ... and has more than one following edge
-				if (myApproachedEdges.find(last)->second.size() > 1) {
+				if (getApproached(last).size() > 1) {
 					// -> let's add this edge and the following, but not any further
 					addNextNoFurther = true;
 				}
@@ -327,71 +505,139 @@ void GARNet::computeRoutesFor(ROEdge* edge,
 		if (!addNextNoFurther) {
 			// ... if this one would be processed, but already too many edge
 			//  without a detector occured
-			if (current.passedNo > maxFollowingLength) {
+			if (nodes[n].state.passedNo > maxFollowingLength) {
 				// mark not to process any further
-				WRITE_WARNING("Could not close route for '" + det.getID() + "'");
-				unfoundEnds.push_back(current);
-				current.factor = 1.;
-				SUMOReal cdist = current.edges2Pass[0]->getFromNode()->getPosition().
-									distanceTo(current.edges2Pass.back()->getToNode()->getPosition());
-				if (minDist < cdist) {
-					std::vector<GARRouteDesc>::iterator it = into.addRouteDesc(current);
-					tripCont.addRouteDesc(dynamic_cast<GAREdge*>(edge),
-										  dynamic_cast<GAREdge*>(last),
-										  *it);
-				}
+				warnings.push_back("Could not close route for '" + det.getID() + "'");
+				unfoundEnds.push_back(n);
+				nodes[n].state.factor = 1.;
+				acceptRoute(n, last);
 				continue;
 			}
 		}
 		// ... else: loop over the next edges
-		const std::vector<ROEdge*>& appr = myApproachedEdges.find(last)->second;
-		bool hadOne = false;
+		const EdgeSpan appr = getApproached(last);
 		for (size_t i = 0; i < appr.size(); i++) {
-			if (find(current.edges2Pass.begin(), current.edges2Pass.end(),
-					appr[i]) != current.edges2Pass.end()) {
+			if (isOnPath(nodes, n, appr[i])) {
 				// do not append an edge twice (do not build loops)
 				continue;
 			}
-			GARRouteDesc t(current);
-			t.duration_2 += (appr[i]->getLength() / appr[i]->getSpeed()); //!!!
-			t.distance += appr[i]->getLength();
-			t.edges2Pass.push_back(appr[i]);
-			if (!addNextNoFurther) {
-				t.passedNo = t.passedNo + 1;
-				toSolve.push(t);
-			} else {
-				if (!hadOne) {
-					t.factor = (SUMOReal) 1. / (SUMOReal) appr.size();
-					SUMOReal cdist = current.edges2Pass[0]->getFromNode()->getPosition()
-											.distanceTo(current.edges2Pass.back()->getToNode()->getPosition());
-					if (minDist < cdist) {
-						std::vector<GARRouteDesc>::iterator it = into.addRouteDesc(current);
-						tripCont.addRouteDesc(dynamic_cast<GAREdge*>(edge),
-											  dynamic_cast<GAREdge*>(last),
-											  *it);
-					}
-					hadOne = true;
-				}
+			if (addNextNoFurther) {
+				// the route ends here, once there is a way further
+				acceptRoute(n, last);
+				break;
+			}
+
+			PathNode child;
+			child.edge = appr[i];
+			child.parent = n;
+			child.pathMask = nodes[n].pathMask | edgeBit(appr[i]);
+			child.detectorSet = nodes[n].detectorSet + (hasDetector(appr[i]) ? edgeHash(appr[i]) : 0);
+			if (limits.dominance && isDominated(dominanceKey(child), n, appr[i])) {
+				numDominated++;
+				continue;
+			}
+			int64_t slot = allocNode();
+			if (slot < 0) {
+				numDropped++;
+				continue;
 			}
+			child.state = nodes[n].state;
+			child.state.duration_2 += (appr[i]->getLength() / appr[i]->getSpeed()); //!!!
+			child.state.distance += appr[i]->getLength();
+			child.state.passedNo = child.state.passedNo + 1;
+			nodes[slot] = child;
+			toSolve.push_back(uint32_t(slot));
+			std::push_heap(toSolve.begin(), toSolve.end(), byDuration);
 		}
+
+		// Drop the slowest partial routes over the cap, leaving room for the next ones
+		if (limits.maxLabels > 0 && toSolve.size() > limits.maxLabels) {
+			dropSlowest(limits.maxLabels - limits.maxLabels / 4);
+		}
+		account();
+	}
+
+	if (logger->isDebugEnabled() && numDominated > 0) {
+		logger->debug("Pruned " + toString(numDominated) + " dominated partial routes from [" + edge->getID() + "]");
+	}
+	if (numDropped > 0) {
+		warnings.push_back("Dropped " + toString(numDropped) + " partial routes from '" + edge->getID() + "' over the "
+						   + (overBudget ? "route search memory budget" : "live partial route cap"));
 	}
 
-	std::vector<GARRouteDesc>::iterator i;
 	std::vector<const ROEdge*> lastDetEdges;
-	for (i = unfoundEnds.begin(); i != unfoundEnds.end(); ++i) {
+	for (uint32_t n : unfoundEnds) {
 		if (find(lastDetEdges.begin(), lastDetEdges.end(),
-				(*i).lastDetectorEdge) == lastDetEdges.end()) {
-			lastDetEdges.push_back((*i).lastDetectorEdge);
+				nodes[n].state.lastDetectorEdge) == lastDetEdges.end()) {
+			lastDetEdges.push_back(nodes[n].state.lastDetectorEdge);
 		} else {
-			bool ok = into.removeRouteDesc(*i);
+			GARRouteDesc route = materializeRoute(nodes, n);
+			bool ok = into.removeRouteDesc(route);
 			assert(ok);
 			UNUSED_PARAMETER(ok); // ony used for assertion
 		}
 	}
+}
 
-	while (!toSolve.empty()) {
-		toSolve.pop();
+
+//................................................. Materialise the route of a path tree node ...
+GARRouteDesc GARNet::materializeRoute(const std::vector<PathNode>& nodes, uint32_t n) {
+	GARRouteDesc route = nodes[n].state;
+
+	size_t length = 0;
+	for (int32_t k = n; k >= 0; k = nodes[k].parent) {
+		length++;
+	}
+
+	route.edges2Pass.resize(length);
+	for (int32_t k = n; k >= 0; k = nodes[k].parent) {
+		route.edges2Pass[--length] = nodes[k].edge;
 	}
+
+	return route;
+}
+
+
+//................................................. Check whether an edge is on the path of a node ...
+bool GARNet::isOnPath(const std::vector<PathNode>& nodes, uint32_t n, const ROEdge* edge) {
+	// The path mask tells most of the edges apart without walking the path
+	if ((nodes[n].pathMask & edgeBit(edge)) == 0) {
+		return false;
+	}
+
+	for (int32_t k = n; k >= 0; k = nodes[k].parent) {
+		if (nodes[k].edge == edge) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//................................................. Get the path mask bit of an edge ...
+uint64_t GARNet::edgeBit(const ROEdge* edge) {
+	return uint64_t(1) << (edgeHash(edge) >> 58);
+}
+
+
+//................................................. Get the hash of an edge ...
+uint64_t GARNet::edgeHash(const ROEdge* edge) {
+	// The finalizer of the 64-bit MurmurHash3 spreads the pointer bits over the hash
+	uint64_t hash = uint64_t(reinterpret_cast<uintptr_t>(edge));
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+
+//................................................. Get the dominance key of a path tree node ...
+uint64_t GARNet::dominanceKey(const PathNode& node) {
+	// The detector set sums the edge hashes, so it does not depend on the order they were passed
+	return node.detectorSet + (edgeHash(node.edge) * 0x9E3779B97F4A7C15ULL);
 }
 
 
@@ -401,31 +647,49 @@ void GARNet::buildRoutes(GARDetectorCon& detCont,
 						 GARRouteCont& rouCont,
 						 GARTripCont& tripCont,
 						 int maxFollowingLength,
+						 const RouteSearchLimits& limits,
+						 int numThreads,
 						 CLogger* logger) const {
 	// Build needed information first
 	this->buildDetectorEdgeDependencies(detCont);
 
-	// Then build the routes
-	std::map<ROEdge*, GARRouteCont*> doneEdges;
-
 	// Get the source and sink detectors
 	const std::vector<GARDetector*>& sources = detCont.getDetectorsByType(SOURCE_DETECTOR);
 
+	// Group the source detectors by edge, in the order the edges are first met
+	std::vector<ROEdge*> sourceEdges;
+	std::vector<std::vector<GARDetector*>> edgeDetectors;
+	std::map<ROEdge*, size_t> edgeIndices;
 	for (GARDetector* pSourceDet : sources) {
-		logger->debug("Compute routes from source detector [" + pSourceDet->getID() + "]...");
-
-		// Check if the detector edge has been processed
 		ROEdge* edge = getDetectorEdge(*pSourceDet);
-		if (doneEdges.find(edge) != doneEdges.end()) {
-			// use previously build routes
-			pSourceDet->addRoutes(new GARRouteCont(*doneEdges[edge]));
-			continue;
+		std::map<ROEdge*, size_t>::iterator it = edgeIndices.find(edge);
+		if (it == edgeIndices.end()) {
+			it = edgeIndices.insert(std::make_pair(edge, sourceEdges.size())).first;
+			sourceEdges.push_back(edge);
+			edgeDetectors.push_back(std::vector<GARDetector*>());
 		}
+		edgeDetectors[it->second].push_back(pSourceDet);
+	}
 
-		std::vector<ROEdge*> seen;
-		GARRouteCont* pDetRouCont = new GARRouteCont();
-		doneEdges[edge] = pDetRouCont;
+	// Split the memory budget in equal shares between the source edges, so the partial routes
+	// a search drops do not depend on the other searches running at the same time
+	RouteSearchLimits sourceLimits = limits;
+	if (limits.memoryBudget > 0 && !sourceEdges.empty()) {
+		sourceLimits.memoryBudget = std::max(limits.memoryBudget / sourceEdges.size(), size_t(1));
+	}
+
+	// Search the routes of every source edge concurrently, from its first detector.
+	// Every search fills its own containers, so it shares nothing but the read-only network.
+	std::vector<SourceRoutes> edgeRoutes(sourceEdges.size());
+	common::ThreadPool pool(std::max(numThreads, 1));
+	pool.parallelFor(sourceEdges.size(), [&] (size_t e) {
+		ROEdge* edge = sourceEdges[e];
+		GARDetector* pSourceDet = edgeDetectors[e].front();
+		if (logger->isDebugEnabled()) {
+			logger->debug("Compute routes from source detector [" + pSourceDet->getID() + "]...");
+		}
 
+		std::vector<ROEdge*> seen;
 		GARRouteDesc rd;
 		rd.edges2Pass.push_back(edge);
 		rd.duration_2 = (edge->getLength() / edge->getSpeed()); //!!!;
@@ -436,28 +700,44 @@ void GARNet::buildRoutes(GARDetectorCon& detCont,
 		rd.duration2Last = 0;
 		rd.overallProb = 0;
 
-		std::vector<ROEdge*> visited;
-		visited.push_back(edge);
-
+		SourceRoutes& result = edgeRoutes[e];
+		result.pRouCont = std::unique_ptr<GARRouteCont>(new GARRouteCont());
 		computeRoutesFor(edge,
 						 rd,
-						 //0,
-						 //visited,
 						 *pSourceDet,
-						 *pDetRouCont,
-						 tripCont,
+						 *result.pRouCont,
+						 result.tripRoutes,
+						 result.warnings,
 						 detCont,
 						 tazCont,
 						 maxFollowingLength,
+						 sourceLimits,
 						 seen,
 						 logger);
-		// Add detector routes
-		pSourceDet->addRoutes(pDetRouCont);
+	});
+
+	// Merge the routes in the source detector order, so the route ids are those of a serial search.
+	// The routes of a source edge are named after it, so the searches never compete for an id.
+	for (size_t e = 0; e < sourceEdges.size(); e++) {
+		SourceRoutes& result = edgeRoutes[e];
+
+		for (const std::string& warning : result.warnings) {
+			WRITE_WARNING(warning);
+		}
+
+		for (const TripRoute& tripRoute : result.tripRoutes) {
+			tripCont.addRouteDesc(tripRoute.pOrig, tripRoute.pDest, tripRoute.rd);
+		}
 
 		// Add routes to container
-		for (GARRouteDesc& rou : pDetRouCont->get()) {
-			rouCont.addRouteDesc(rou);
+		result.pRouCont->addRoutesTo(rouCont);
+
+		// Add detector routes: the other detectors of the edge get a copy
+		const std::vector<GARDetector*>& detectors = edgeDetectors[e];
+		for (size_t d = 1; d < detectors.size(); d++) {
+			detectors[d]->addRoutes(new GARRouteCont(*result.pRouCont));
 		}
+		detectors.front()->addRoutes(result.pRouCont.release());
 	}
 }
 
@@ -495,8 +775,8 @@ void GARNet::revalidateFlows(const GARDetector* detector,
 		while (!missing.empty() && !maxDepthReached) {
 			IterationEdge last = missing.back();
 			missing.pop_back();
-			std::vector<ROEdge*> approaching = myApproachingEdges[last.edge];
-			for (std::vector<ROEdge*>::const_iterator j = approaching.begin();
+			const EdgeSpan approaching = getApproaching(last.edge);
+			for (EdgeSpan::iterator j = approaching.begin();
 					j != approaching.end(); ++j) {
 				if (hasDetector(*j)) {
 					previous.push_back(*j);
@@ -530,8 +810,8 @@ void GARNet::revalidateFlows(const GARDetector* detector,
 		while (!missing.empty() && !maxDepthReached) {
 			IterationEdge last = missing.back();
 			missing.pop_back();
-			std::vector<ROEdge*> approached = myApproachedEdges[last.edge];
-			for (std::vector<ROEdge*>::const_iterator j = approached.begin();
+			const EdgeSpan approached = getApproached(last.edge);
+			for (EdgeSpan::iterator j = approached.begin();
 					j != approached.end(); ++j) {
 				if (*j == getDetectorEdge(*detector)) {
 					continue;
@@ -688,23 +968,43 @@ GARNet::getDetectorEdge(const GARDetector& det) const {
 }
 
 bool GARNet::hasApproaching(ROEdge* edge) const {
-	return myApproachingEdges.find(edge) != myApproachingEdges.end()
-			&& myApproachingEdges.find(edge)->second.size() != 0;
+	return getApproaching(edge).size() != 0;
 }
 
 bool GARNet::hasApproached(ROEdge* edge) const {
-	return myApproachedEdges.find(edge) != myApproachedEdges.end()
-			&& myApproachedEdges.find(edge)->second.size() != 0;
+	return getApproached(edge).size() != 0;
+}
+
+GARNet::EdgeSpan GARNet::getApproaching(const ROEdge* edge) const {
+	size_t id = edge->getNumericalID();
+	if (id + 1 >= myApproachingOffsets.size()) {
+		return EdgeSpan { nullptr, nullptr };
+	}
+	return EdgeSpan { myApproachingEdges.data() + myApproachingOffsets[id],
+					  myApproachingEdges.data() + myApproachingOffsets[id + 1] };
+}
+
+GARNet::EdgeSpan GARNet::getApproached(const ROEdge* edge) const {
+	size_t id = edge->getNumericalID();
+	if (id + 1 >= myApproachedOffsets.size()) {
+		return EdgeSpan { nullptr, nullptr };
+	}
+	return EdgeSpan { myApproachedEdges.data() + myApproachedOffsets[id],
+					  myApproachedEdges.data() + myApproachedOffsets[id + 1] };
 }
 
 bool GARNet::hasDetector(ROEdge* edge) const {
-	return myDetectorsOnEdges.find(edge) != myDetectorsOnEdges.end()
-			&& myDetectorsOnEdges.find(edge)->second.size() != 0;
+	size_t id = edge->getNumericalID();
+	return id < myDetectorEdgeBits.size() && myDetectorEdgeBits[id];
 }
 
-const std::vector<std::string>&
-GARNet::getDetectorList(ROEdge* edge) const {
-	return myDetectorsOnEdges.find(edge)->second;
+GARNet::DetectorSpan GARNet::getDetectorList(const ROEdge* edge) const {
+	size_t id = edge->getNumericalID();
+	if (id + 1 >= myDetectorOffsets.size()) {
+		return DetectorSpan { nullptr, nullptr };
+	}
+	return DetectorSpan { myDetectorIds.data() + myDetectorOffsets[id],
+						  myDetectorIds.data() + myDetectorOffsets[id + 1] };
 }
 
 
@@ -717,14 +1017,33 @@ GARNet::getNodeList(void) const {
 const ROEdge const*
 GARNet::getpEdge(const std::string& fromNode,
 				 const std::string& toNode) const {
-	for (auto edge : myDetectorEdges) {
-		const ROEdge const* pEdge = edge.second;
-		if (fromNode == pEdge->getFromNode()->getID()  &&  toNode == pEdge->getToNode()->getID()) {
-			return pEdge;
-		}
+	// nodes not bounding any detector edge have no index
+	std::unordered_map<std::string, uint32_t>::const_iterator from =
+			myNodeIndices.find(fromNode);
+	std::unordered_map<std::string, uint32_t>::const_iterator to =
+			myNodeIndices.find(toNode);
+	if (from == myNodeIndices.end() || to == myNodeIndices.end()) {
+		return nullptr;
+	}
+
+	std::unordered_map<uint64_t, const ROEdge*>::const_iterator it =
+			myNodePairEdges.find(nodePairKey(from->second, to->second));
+	if (it == myNodePairEdges.end()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return it->second;
+}
+
+
+uint64_t GARNet::nodePairKey(uint32_t fromNodeIdx, uint32_t toNodeIdx) {
+	return ((uint64_t)fromNodeIdx << 32) | toNodeIdx;
+}
+
+
+uint32_t GARNet::indexNode(const std::string& node) const {
+	return myNodeIndices.insert(std::make_pair(node,
+			(uint32_t)myNodeIndices.size())).first->second;
 }
 
 
@@ -765,9 +1084,8 @@ bool GARNet::isSource(const GARDetector& det, ROEdge* edge,
 	if (edge == getDetectorEdge(det)) {
 		// maybe there is another detector at the same edge
 		//  get the list of this/these detector(s)
-		const std::vector<std::string>& detsOnEdge = myDetectorsOnEdges.find(
-				edge)->second;
-		for (std::vector<std::string>::const_iterator i = detsOnEdge.begin();
+		const DetectorSpan detsOnEdge = getDetectorList(edge);
+		for (DetectorSpan::iterator i = detsOnEdge.begin();
 				i != detsOnEdge.end(); ++i) {
 			if ((*i) == det.getID()) {
 				continue;
@@ -799,8 +1117,7 @@ bool GARNet::isSource(const GARDetector& det, ROEdge* edge,
 				}
 				// the next is a hack for the A100 scenario...
 				//  We have to look into further edges herein edges
-				const std::vector<ROEdge*>& appr =
-						myApproachingEdges.find(edge)->second;
+				const EdgeSpan appr = getApproaching(edge);
 				size_t noOk = 0;
 				size_t noFalse = 0;
 				size_t noSkipped = 0;
@@ -827,13 +1144,13 @@ bool GARNet::isSource(const GARDetector& det, ROEdge* edge,
 			}
 		}
 	}
-	if (myDetectorsOnEdges.find(edge) != myDetectorsOnEdges.end()
+	if (hasDetector(edge)
 			&& myDetectorEdges.find(det.getID())->second != edge) {
 		return false;
 	}
 
 	// let's check the edges in front
-	const std::vector<ROEdge*>& appr = myApproachingEdges.find(edge)->second;
+	const EdgeSpan appr = getApproaching(edge);
 	size_t noOk = 0;
 	size_t noFalse = 0;
 	size_t noSkipped = 0;
@@ -868,9 +1185,8 @@ bool GARNet::isDestination(const GARDetector& det, ROEdge* edge,
 	if (edge == getDetectorEdge(det)) {
 		// maybe there is another detector at the same edge
 		//  get the list of this/these detector(s)
-		const std::vector<std::string>& detsOnEdge = myDetectorsOnEdges.find(
-				edge)->second;
-		for (std::vector<std::string>::const_iterator i = detsOnEdge.begin();
+		const DetectorSpan detsOnEdge = getDetectorList(edge);
+		for (DetectorSpan::iterator i = detsOnEdge.begin();
 				i != detsOnEdge.end(); ++i) {
 			if ((*i) == det.getID()) {
 				continue;
@@ -908,18 +1224,18 @@ bool GARNet::isDestination(const GARDetector& det, ROEdge* edge,
 			if (hasDetector(edge)) {
 				return true;
 			}
-			if (myApproachedEdges.find(edge)->second.size() > 1) {
+			if (getApproached(edge).size() > 1) {
 				return true;
 			}
 
 		}
 	}
 
-	if (myDetectorsOnEdges.find(edge) != myDetectorsOnEdges.end()
+	if (hasDetector(edge)
 			&& myDetectorEdges.find(det.getID())->second != edge) {
 		return false;
 	}
-	const std::vector<ROEdge*>& appr = myApproachedEdges.find(edge)->second;
+	const EdgeSpan appr = getApproached(edge);
 	bool isall = true;
 	size_t no = 0;
 	seen.push_back(edge);
@@ -947,9 +1263,8 @@ bool GARNet::isFalseSource(const GARDetector& det, ROEdge* edge,
 	if (edge != getDetectorEdge(det)) {
 		// ok, we are at one of the edges coming behind
 		if (hasDetector(edge)) {
-			const std::vector<std::string>& dets =
-					myDetectorsOnEdges.find(edge)->second;
-			for (std::vector<std::string>::const_iterator i = dets.begin();
+			const DetectorSpan dets = getDetectorList(edge);
+			for (DetectorSpan::iterator i = dets.begin();
 					i != dets.end(); ++i) {
 				if (detectors.getDetector(*i).getType() == SINK_DETECTOR) {
 					return false;
@@ -968,11 +1283,11 @@ bool GARNet::isFalseSource(const GARDetector& det, ROEdge* edge,
 		}
 	}
 
-	if (myApproachedEdges.find(edge) == myApproachedEdges.end()) {
+	if (!hasApproached(edge)) {
 		return false;
 	}
 
-	const std::vector<ROEdge*>& appr = myApproachedEdges.find(edge)->second;
+	const EdgeSpan appr = getApproached(edge);
 	bool isall = false;
 	for (size_t i = 0; i < appr.size() && !isall; i++) {
 		//printf("checking %s->\n", appr[i].c_str());
@@ -989,13 +1304,13 @@ bool GARNet::isFalseSource(const GARDetector& det, ROEdge* edge,
 void GARNet::buildEdgeFlowMap(const GARDetectorFlows& flows,
 		const GARDetectorCon& detectors, SUMOTime startTime, SUMOTime endTime,
 		SUMOTime stepOffset) {
-	std::map<ROEdge*, std::vector<std::string>, idComp>::iterator i;
-	for (i = myDetectorsOnEdges.begin(); i != myDetectorsOnEdges.end(); ++i) {
-		ROEdge* into = (*i).first;
-		const std::vector<std::string>& dets = (*i).second;
+	std::vector<ROEdge*>::const_iterator i;
+	for (i = myDetectorEdgeList.begin(); i != myDetectorEdgeList.end(); ++i) {
+		ROEdge* into = *i;
+		const DetectorSpan dets = getDetectorList(into);
 		std::map<SUMOReal, std::vector<std::string> > cliques;
 		std::vector<std::string>* maxClique = 0;
-		for (std::vector<std::string>::const_iterator j = dets.begin();
+		for (DetectorSpan::iterator j = dets.begin();
 				j != dets.end(); ++j) {
 			if (!flows.knows(*j)) {
 				continue;
@@ -1080,9 +1395,8 @@ void GARNet::buildDetectorDependencies(GARDetectorCon& detectors) {
 		// mark current detectors
 		std::vector<GARDetector*> last;
 		{
-			const std::vector<std::string>& detNames = myDetectorsOnEdges.find(
-					(*i).second)->second;
-			for (std::vector<std::string>::const_iterator j = detNames.begin();
+			const DetectorSpan detNames = getDetectorList((*i).second);
+			for (DetectorSpan::iterator j = detNames.begin();
 					j != detNames.end(); ++j) {
 				last.push_back(&detectors.getModifiableDetector(*j));
 			}
@@ -1094,14 +1408,13 @@ void GARNet::buildDetectorDependencies(GARDetectorCon& detectors) {
 			const std::vector<ROEdge*>& edges2Pass = (*j).edges2Pass;
 			for (std::vector<ROEdge*>::const_iterator k = edges2Pass.begin()
 					+ 1; k != edges2Pass.end(); ++k) {
-				if (myDetectorsOnEdges.find(*k) != myDetectorsOnEdges.end()) {
-					const std::vector<std::string>& detNames =
-							myDetectorsOnEdges.find(*k)->second;
+				if (hasDetector(*k)) {
+					const DetectorSpan detNames = getDetectorList(*k);
 					// ok, consecutive detector found
 					for (std::vector<GARDetector*>::iterator l = last.begin();
 							l != last.end(); ++l) {
 						// mark as follower of current
-						for (std::vector<std::string>::const_iterator m =
+						for (DetectorSpan::iterator m =
 								detNames.begin(); m != detNames.end(); ++m) {
 							detectors.getModifiableDetector(*m).addPriorDetector(
 									*l);
@@ -1110,7 +1423,7 @@ void GARNet::buildDetectorDependencies(GARDetectorCon& detectors) {
 						}
 					}
 					last.clear();
-					for (std::vector<std::string>::const_iterator m =
+					for (DetectorSpan::iterator m =
 							detNames.begin(); m != detNames.end(); ++m) {
 						last.push_back(&detectors.getModifiableDetector(*m));
 					}
@@ -1122,12 +1435,12 @@ void GARNet::buildDetectorDependencies(GARDetectorCon& detectors) {
 
 void GARNet::mesoJoin(GARDetectorCon& detectors, GARDetectorFlows& flows) {
 	buildDetectorEdgeDependencies(detectors);
-	std::map<ROEdge*, std::vector<std::string>, idComp>::iterator i;
-	for (i = myDetectorsOnEdges.begin(); i != myDetectorsOnEdges.end(); ++i) {
-		const std::vector<std::string>& dets = (*i).second;
+	std::vector<ROEdge*>::const_iterator i;
+	for (i = myDetectorEdgeList.begin(); i != myDetectorEdgeList.end(); ++i) {
+		const DetectorSpan dets = getDetectorList(*i);
 		std::map<SUMOReal, std::vector<std::string> > cliques;
 		// compute detector cliques
-		for (std::vector<std::string>::const_iterator j = dets.begin();
+		for (DetectorSpan::iterator j = dets.begin();
 				j != dets.end(); ++j) {
 			const GARDetector& det = detectors.getDetector(*j);
 			bool found = false;
@@ -31,6 +31,8 @@
 
 #include <fstream>
 #include <cassert>
+#include <functional>
+#include <unordered_set>
 #include "GARRouteDesc.hpp"
 #include "GARRouteCont.hpp"
 #include "GARNet.hpp"
@@ -56,39 +58,35 @@ GARRouteCont::~GARRouteCont() {
 }
 
 std::vector<GARRouteDesc>::iterator GARRouteCont::addRouteDesc(GARRouteDesc& desc) {
-	std::vector<GARRouteDesc>::iterator it;
-
-	it = find_if(myRoutes.begin(), myRoutes.end(), route_finder(desc));
+	size_t index = findSame(desc);
 
 	// routes may be duplicate as in-between routes may have different starting points
-	if (it == myRoutes.end()) {
+	if (index == myRoutes.size()) {
 		// compute route id
 		this->setID(desc);
-		it = myRoutes.insert(myRoutes.end(), desc);
+		myRoutes.push_back(desc);
+		myEdgesIndex.insert(std::make_pair(hashEdges(desc.edges2Pass), index));
+		myNameIndex[desc.routename] = index;
 	} else {
-		GARRouteDesc& prev = *it;
+		GARRouteDesc& prev = myRoutes[index];
 		prev.overallProb += desc.overallProb;
 	}
 
-	return it;
+	return myRoutes.begin() + index;
 }
 
 bool GARRouteCont::removeRouteDesc(GARRouteDesc& desc) {
-	std::vector<GARRouteDesc>::const_iterator j = find_if(myRoutes.begin(),
-			myRoutes.end(), route_finder(desc));
-	if (j == myRoutes.end()) {
-		return false;
-	}
-	return true;
+	return findSame(desc) != myRoutes.size();
 }
 
 bool GARRouteCont::save(std::vector<std::string>& saved,
 		const std::string& prependix, OutputDevice& out) {
 	bool haveSavedOneAtLeast = false;
+	std::unordered_set<std::string> savedNames(saved.begin(), saved.end());
 	for (std::vector<GARRouteDesc>::const_iterator j = myRoutes.begin();
 			j != myRoutes.end(); ++j) {
 		const GARRouteDesc& desc = (*j);
-		if (find(saved.begin(), saved.end(), desc.routename) != saved.end()) {
+		if (!savedNames.insert(desc.routename).second) {
 			continue;
 		}
 		saved.push_back((*j).routename);
@@ -112,6 +110,7 @@ bool GARRouteCont::save(std::vector<std::string>& saved,
 
 void GARRouteCont::sortByDistance() {
 	sort(myRoutes.begin(), myRoutes.end(), by_distance_sorter());
+	rebuildIndices();
 }
 
 void GARRouteCont::removeIllegal(
@@ -140,18 +139,31 @@ void GARRouteCont::removeIllegal(
 			++i;
 		}
 	}
+	rebuildIndices();
 }
 
 
-std::shared_ptr<const GARRouteDesc> GARRouteCont::getRouteDesc(const std::string& routeName) const {
-	auto searchByRouteName = [&routeName] (const GARRouteDesc& rd) { return rd.routename == routeName; };
-
-	std::vector<GARRouteDesc>::const_iterator it = std::find_if(myRoutes.begin(), myRoutes.end(), searchByRouteName);
-	if (it == myRoutes.end()) {
+const GARRouteDesc* GARRouteCont::getRouteDesc(const std::string& routeName) const {
+	std::unordered_map<std::string, size_t>::const_iterator it = myNameIndex.find(routeName);
+	if (it == myNameIndex.end() || it->second >= myRoutes.size()) {
 		return nullptr;
 	}
 
-	return std::make_shared<const GARRouteDesc>(*it);
+	return &myRoutes[it->second];
+}
+
+
+void GARRouteCont::setOverallProb(size_t route, SUMOReal prob) {
+	myRoutes[route].overallProb = prob;
+}
+
+
+void GARRouteCont::addRoutesTo(GARRouteCont& into) {
+	for (std::vector<GARRouteDesc>::iterator i = myRoutes.begin(); i != myRoutes.end(); ++i) {
+		into.addRouteDesc(*i);
+	}
+	// the routes new to the other container were renamed
+	rebuildIndices();
 }
 
 
@@ -167,5 +179,36 @@ void GARRouteCont::setID(GARRouteDesc& desc) const {
 	}
 }
 
+
+size_t GARRouteCont::hashEdges(const std::vector<ROEdge*>& edges) {
+	size_t hash = edges.size();
+	for (std::vector<ROEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+		hash ^= std::hash<const ROEdge*>()(*i) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	}
+	return hash;
+}
+
+
+size_t GARRouteCont::findSame(const GARRouteDesc& desc) const {
+	route_finder same(desc);
+	auto range = myEdgesIndex.equal_range(hashEdges(desc.edges2Pass));
+	for (auto it = range.first; it != range.second; ++it) {
+		if (same(myRoutes[it->second])) {
+			return it->second;
+		}
+	}
+	return myRoutes.size();
+}
+
+
+void GARRouteCont::rebuildIndices() {
+	myEdgesIndex.clear();
+	myNameIndex.clear();
+	for (size_t i = 0; i < myRoutes.size(); i++) {
+		myEdgesIndex.insert(std::make_pair(hashEdges(myRoutes[i].edges2Pass), i));
+		myNameIndex[myRoutes[i].routename] = i;
+	}
+}
+
 /****************************************************************************/
 
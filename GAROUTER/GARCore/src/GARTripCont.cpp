@@ -66,18 +66,24 @@ void GARTripCont::addRouteDesc(const GAREdge const* pOrig,
 
 	if (it != odTrips.end()) {
 		// Get the found trip
-		logger->debug("Found trip between origin [" + pOrig->getID() + "] and destination [" + pDest->getID() + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("Found trip between origin [" + pOrig->getID() + "] and destination [" + pDest->getID() + "]");
+		}
 		pTrip = (*it);
 
 	} else {
 		// Create a new trip
-		logger->debug("Insert new trip between origin [" + pOrig->getID() + "] and destination [" + pDest->getID() + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("Insert new trip between origin [" + pOrig->getID() + "] and destination [" + pDest->getID() + "]");
+		}
 		pTrip = std::make_shared<const GARTrip>(GARTrip(pOrig, pDest, logger));
 		odTrips.insert(pTrip);
 	}
 
 	// Add route to trip
-	logger->debug("Add route [" + rd.routename + "] to the trip");
+	if (logger->isDebugEnabled()) {
+		logger->debug("Add route [" + rd.routename + "] to the trip");
+	}
 	const_cast<GARTrip&>(*pTrip).addRoute(rd);
 }
 
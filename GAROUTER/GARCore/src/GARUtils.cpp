@@ -157,7 +157,7 @@ const GAREdge const* GARUtils::getOriginEdge(const GARRouteCont const* pRouCont,
 		return nullptr;
 	}
 
-	std::shared_ptr<const GARRouteDesc> pRd = pRouCont->getRouteDesc(routeName);
+	const GARRouteDesc* pRd = pRouCont->getRouteDesc(routeName);
 	if (pRd == nullptr) {
 		return nullptr;
 	}
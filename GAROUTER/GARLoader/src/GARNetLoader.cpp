@@ -94,9 +94,10 @@ void GARNetLoader::logNet(void) const {
 			logger->info("\tPredecessor [" + StringUtilities::toString(i) + "]: " + predecessor->getID());
 		}
 		try {
-			vector<string> detectors = pNet->getDetectorList(pEdge);
+			GARNet::DetectorSpan detList = pNet->getDetectorList(pEdge);
+			vector<string> detectors(detList.begin(), detList.end());
 			if (!detectors.empty()) {
-				logger->info("\tDetectors: " + StringUtilities::toString(pNet->getDetectorList(pEdge)));
+				logger->info("\tDetectors: " + StringUtilities::toString(detectors));
 			} else {
 				logger->info("\tNo detectors defined");
 			}
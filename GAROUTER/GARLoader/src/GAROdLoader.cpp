@@ -70,7 +70,9 @@ int GAROdLoader::run(void) {
 			if (StringUtilities::startsWith(line, COMMENT_CHARACTER)) {
 				continue;
 			}
-			logger->debug("Load OD matrix data from line: [" + line + "]");
+			if (logger->isDebugEnabled()) {
+				logger->debug("Load OD matrix data from line: [" + line + "]");
+			}
 
 			// Process the OD matrix data file line
 			id = processOdMatrixLine(id, line);
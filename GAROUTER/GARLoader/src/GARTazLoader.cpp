@@ -220,7 +220,9 @@ edge_set GARTazLoader::parseEdgesAttribute(const std::string & edgesAttr)
 	vector<string> edges = StringUtilities::split(edgesAttr, ' ');
 	for (string edgeId : edges) {
 		try {
-			logger->debug("\tInsert edge [" + edgeId + "]");
+			if (logger->isDebugEnabled()) {
+				logger->debug("\tInsert edge [" + edgeId + "]");
+			}
 			const GAREdge const* pEdge = dynamic_cast<GAREdge*>(this->net.getEdge(edgeId));
 			tazEdges.insert(pEdge);
 		} catch (std::bad_cast& ex) {
@@ -253,7 +255,9 @@ edge_set GARTazLoader::parseTazEdges(const boost_pt::ptree::value_type& taz,
 			continue;
 		}
 		try {
-			logger->debug("\tInsert edge [" + edgeId + "]");
+			if (logger->isDebugEnabled()) {
+				logger->debug("\tInsert edge [" + edgeId + "]");
+			}
 			const GAREdge const* pEdge = dynamic_cast<GAREdge*>(this->net.getEdge(edgeId));
 			tazEdges.insert(pEdge);
 		} catch (std::bad_cast& ex) {
@@ -360,7 +364,9 @@ taz_set GARTazLoader::parseODTazs(const boost_pt::ptree::value_type& odgroup)
 			continue;
 		}
 
-		logger->debug("\tInsert TAZ [" + pTaz->getId() + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("\tInsert TAZ [" + pTaz->getId() + "]");
+		}
 		if (odtazs.insert(pTaz).second == false) {
 			logger->warning("Trying to insert existing taz [" + tazId + "]");
 		}
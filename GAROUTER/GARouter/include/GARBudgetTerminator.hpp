@@ -0,0 +1,107 @@
+/*
+ * GARBudgetTerminator.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARBUDGETTERMINATOR_HPP_
+#define GARBUDGETTERMINATOR_HPP_
+
+#include <ga/GABaseGA.h>
+#include <chrono>
+#include <string>
+
+namespace gar {
+
+/**
+ * @brief This class implements a termination function bound to a wall-clock budget.
+ * The evolution stops at the requested number of generations, when the deadline is reached,
+ * or when the best score has not improved by the minimum improvement for a number of generations.
+ *
+ * The deadline is shared by all the genetic algorithms using the terminator, so the dynamic
+ * approach gets the budget the static approach left. The terminator is reached through the
+ * user data of the genetic algorithm.
+ */
+class GARBudgetTerminator {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARBudgetTerminator() = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param timeBudget		The wall-clock budget in seconds, <code>0</code> for no deadline.
+	 * @param stallGenerations	The generations without improvement stopping the evolution, <code>0</code> to disable it.
+	 * @param minImprovement	The smallest change of the best score counted as an improvement.
+	 */
+	GARBudgetTerminator(double timeBudget, int stallGenerations, float minImprovement);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARBudgetTerminator() = default;
+
+	/**
+	 * Start the clock of the budget, unless it is already running,
+	 * and restart the stall detection for a new evolution.
+	 */
+	void start(void);
+
+	/**
+	 * Check whether the deadline is reached.
+	 * @return	<code>true</code> if the budget is spent, <code>false</code> otherwise.
+	 */
+	bool expired(void) const;
+
+	/**
+	 * Get the reason of the last termination.
+	 * @return	The reason, empty if the evolution has not been stopped by the terminator.
+	 */
+	const std::string& getReason(void) const;
+
+	/**
+	 * The termination function. It falls back to the termination upon generation
+	 * if the genetic algorithm has no terminator as user data.
+	 * @param ga	The genetic algorithm.
+	 * @return		<code>gaTrue</code> if the evolution is finished, <code>gaFalse</code> otherwise.
+	 */
+	static GABoolean TerminateUponBudget(GAGeneticAlgorithm& ga);
+
+private:
+	/**
+	 * Check whether the evolution shall stop, tracking the best score.
+	 * @param ga	The genetic algorithm.
+	 * @return		<code>true</code> if the evolution is finished, <code>false</code> otherwise.
+	 */
+	bool terminate(const GAGeneticAlgorithm& ga);
+
+	//! The wall-clock budget in seconds
+	double timeBudget;
+
+	//! The generations without improvement stopping the evolution
+	int stallGenerations;
+
+	//! The smallest change of the best score counted as an improvement
+	float minImprovement;
+
+	//! Whether the clock is running
+	bool started;
+
+	//! The deadline
+	std::chrono::steady_clock::time_point deadline;
+
+	//! The best score so far
+	float bestScore;
+
+	//! The generation of the last improvement, negative before the first generation
+	int improvedAt;
+
+	//! The reason of the last termination
+	std::string reason;
+};
+
+} /* namespace gar */
+
+#endif /* GARBUDGETTERMINATOR_HPP_ */
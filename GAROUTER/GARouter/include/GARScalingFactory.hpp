@@ -11,12 +11,14 @@
 #include <CLogger.hpp>
 #include <utils/options/OptionsCont.h>
 #include <ga/ga.h>
+#include <cstdint>
 
 using common::CLogger;
 
 namespace gar {
 
-typedef GA1DArrayAlleleGenome<const char*> genome_static;
+typedef GA1DArrayAlleleGenome<uint16_t> genome_static;
+typedef GA1DArrayAlleleGenome<uint32_t> genome_static_wide;
 typedef GA1DArrayAlleleGenome<int> genome_dyn;
 
 /**
@@ -107,14 +109,15 @@ private:
 	/**
 	 * @brief Computes the distance between two genomes defined in the static aproach.
 	 * A genome defined in the static approach is an array of allele sets. An allele is
-	 * a string containing the name of a vehicle route.
-	 * All we do is check to see if the allele arrays are identical regardless the position of the genes.
+	 * the local index of a vehicle route within the candidate routes of the gene OD pair.
+	 * All we do is check to see if the routes of the genomes are identical regardless the position of the genes.
 	 * @param genome1	An individual in the static approach population.
 	 * @param genome2	Another individual in the static approach population.
 	 * @return			A float number between 0 and 1. If the genomes are the same, then we return a 0.
 	 * 					If they are completely different then we return a 1.
 	 */
-	static float computeStaticDistance(const genome_static& genome1, const genome_static& genome2);
+	template<class Genome>
+	static float computeStaticDistance(const Genome& genome1, const Genome& genome2);
 
 	/**
 	 * @brief Computes the distance between two genomes defined in the dynamic aproach.
@@ -0,0 +1,199 @@
+/*
+ * GARSimResultStore.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARSIMRESULTSTORE_HPP_
+#define GARSIMRESULTSTORE_HPP_
+
+#include <CLogger.hpp>
+#include <HashUtilities.hpp>
+#include <GARDetectorFlow.hpp>
+#include <utils/common/SUMOTime.h>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+using common::Hash128;
+
+namespace gar {
+
+/**
+ * @brief This class implements a persistent store of simulation results that survives across runs.
+ * It maps the hash of a genome to the vehicle counts measured by every detector in every time interval.
+ * The records are appended to a local file, which is memory-mapped to read them back. The file is
+ * indexed when it is opened, and a torn record left by an interrupted run is truncated.
+ *
+ * Every record key is combined with a fingerprint of the scenario (network, routes, induction
+ * loops, goal flows and simulator settings), so the results of a different scenario are never
+ * returned and a single file can hold the results of several scenarios.
+ */
+class GARSimResultStore {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARSimResultStore() = delete;
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other store.
+	 */
+	GARSimResultStore(const GARSimResultStore& other) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param logger	The logger.
+	 */
+	GARSimResultStore(CLogger* logger);
+
+	/**
+	 * Virtual destructor. It unmaps and closes the store file.
+	 */
+	virtual ~GARSimResultStore();
+
+	/**
+	 * Open the store file, creating it if it does not exist, and index its records.
+	 * @param path			The store file path.
+	 * @param fingerprint	The fingerprint of the scenario.
+	 * @param detectorIds	The identifiers of the detectors whose counts are stored, in record order.
+	 * @param begin			The simulation beginning time in seconds.
+	 * @param end			The simulation end time in seconds.
+	 * @param timeStep		The time interval between two successive counts.
+	 * @return				<code>0</code> if the store is opened, <code>1</code> otherwise.
+	 */
+	int open(const std::string& path,
+			 const Hash128& fingerprint,
+			 const std::vector<std::string>& detectorIds,
+			 const SUMOTime& begin,
+			 const SUMOTime& end,
+			 const SUMOTime& timeStep);
+
+	/**
+	 * Look up the simulated detector flows of a genome.
+	 * @param genomeKey	The hash of the genome genes.
+	 * @return			The detector flows holding the stored vehicle counts,
+	 * 					or <code>nullptr</code> if the genome is not stored.
+	 */
+	std::shared_ptr<GARDetectorFlows> find(const Hash128& genomeKey);
+
+	/**
+	 * Append the simulated detector flows of a genome to the store.
+	 * @param genomeKey	The hash of the genome genes.
+	 * @param flows		The simulated detector flows.
+	 * @return			<code>0</code> if the record is stored, <code>1</code> otherwise.
+	 */
+	int insert(const Hash128& genomeKey, const GARDetectorFlows& flows);
+
+	/**
+	 * Get the number of indexed records.
+	 * @return	The number of records.
+	 */
+	size_t size(void);
+
+	/**
+	 * Get the number of lookup hits.
+	 * @return	The number of hits.
+	 */
+	uint64_t getHits(void) const;
+
+	/**
+	 * Get the number of lookup misses.
+	 * @return	The number of misses.
+	 */
+	uint64_t getMisses(void) const;
+
+	//! The magic bytes at the beginning of a store file
+	static const char MAGIC[8];
+
+	//! The store file format version
+	static const uint32_t VERSION;
+
+private:
+	/**
+	 * The header of a stored record, followed by numDetectors x numSteps counts.
+	 * A detector without measurements stores NaN counts.
+	 */
+	struct RecordHeader {
+		//! The record key
+		uint64_t keyLo;
+		uint64_t keyHi;
+
+		//! The number of detectors
+		uint32_t numDetectors;
+
+		//! The number of time intervals
+		uint32_t numSteps;
+	};
+
+	/**
+	 * Index the records of the store file from an offset to its end.
+	 * A torn record at the end of the file is truncated.
+	 * @param from	The file offset of the first record to index.
+	 * @return		<code>0</code> if the file is indexed, <code>1</code> otherwise.
+	 */
+	int scan(uint64_t from);
+
+	/**
+	 * Map the store file up to its current size.
+	 * @return	<code>0</code> if the file is mapped, <code>1</code> otherwise.
+	 */
+	int remap(void);
+
+	/**
+	 * Unmap the store file.
+	 */
+	void unmap(void);
+
+	//! The logger
+	CLogger* logger;
+
+	//! The store file descriptor
+	int fd;
+
+	//! The mapped store file
+	char* pMap;
+
+	//! The number of mapped bytes
+	uint64_t mapSize;
+
+	//! The store file size known to this process
+	uint64_t fileSize;
+
+	//! The scenario fingerprint
+	Hash128 fingerprint;
+
+	//! The detector identifiers, in record order
+	std::vector<std::string> detectorIds;
+
+	//! The simulation beginning time in seconds
+	SUMOTime begin;
+
+	//! The simulation end time in seconds
+	SUMOTime end;
+
+	//! The time interval between two successive counts
+	SUMOTime timeStep;
+
+	//! The file offset of every record, by key
+	std::unordered_map<Hash128, uint64_t, common::Hash128Hasher> index;
+
+	//! The mutex guarding the file and the index
+	std::mutex mtx;
+
+	//! The number of lookup hits
+	std::atomic<uint64_t> hits;
+
+	//! The number of lookup misses
+	std::atomic<uint64_t> misses;
+};
+
+} /* namespace gar */
+
+#endif /* GARSIMRESULTSTORE_HPP_ */
@@ -15,8 +15,12 @@
 #include <GARTripCont.hpp>
 #include <GARStaticObjData.hpp>
 #include <GARDynObjData.hpp>
+#include <GARCheckpoint.hpp>
+#include <GARBudgetTerminator.hpp>
 #include <GAROdMatrix.hpp>
-#include <Graph.hpp>
+#include <CSRYenKShortestPathsAlg.hpp>
+#include <unordered_map>
+#include <chrono>
 #include <utils/options/OptionsCont.h>
 #include <ga/ga.h>
 
@@ -25,9 +29,25 @@ using common::CLogger;
 
 namespace gar {
 
-typedef GA1DArrayAlleleGenome<const char*> genome_static;
+typedef GA1DArrayAlleleGenome<uint16_t> genome_static;
+typedef GA1DArrayAlleleGenome<uint32_t> genome_static_wide;
 typedef GA1DArrayAlleleGenome<int> genome_dyn;
 
+/**
+ * @brief The network graph used by the k-shortest-path algorithm.
+ * The network nodes are the graph vertices and every non-internal network edge is a graph edge.
+ */
+struct GARKShortestGraph {
+	//! The graph in CSR form
+	CSRGraph graph;
+
+	//! The graph vertex of every network node identifier
+	std::unordered_map<std::string, uint32_t> nodeIndices;
+
+	//! The network edge of every graph edge
+	std::vector<const ROEdge*> edges;
+};
+
 /**
  * @class GARouter
  * This class implements the disaggregation traffic flow router making use of
@@ -164,14 +184,22 @@ public:
 	 * Copy the best genome solution from the GA evolution in the \link GARouter::pStaticSolution \endlink attribute.
 	 * @param best	The best solution of the GA for the static approach.
 	 */
-	void setStaticSolution(const genome_static& best);
+	void setStaticSolution(const GAGenome& best);
 
 	/**
 	 * @brief Get the GA solution for the static approach.
-	 * Returns a string vector enclosing the route names defining the traffic flow.
+	 * The solution is either a trip genome or a count-per-route genome, depending on the 'static-encoding' option.
+	 * @return A pointer to the best genome of the static approach, or <code>nullptr</code> if it is not computed.
+	 */
+	const GAGenome const* getStaticSolution(void) const;
+
+	/**
+	 * @brief Decode the GA solution for the static approach.
+	 * Resolves every gene of the static solution into the name of the route it selects
+	 * within the candidate routes of its OD pair.
 	 * @return A vector containing the route names of the solution for the static approach.
 	 */
-	gar::genome_static getStaticSolution(void) const;
+	std::vector<std::string> getStaticSolutionRoutes(void) const;
 
 	/**
 	 * @brief Print the static solution.
@@ -189,6 +217,28 @@ public:
 	 */
 	bool triggerDynamicGA(void) const;
 
+	/**
+	 * @brief Load the checkpoint to resume the evolution from, if the 'resume' option is set.
+	 * @return	<code>0</code> if the checkpoint is loaded or there is nothing to resume,
+	 * 			<code>1</code> otherwise.
+	 * @see GARCheckpoint
+	 */
+	int loadCheckpoint(void);
+
+	/**
+	 * @brief Check whether the run resumes the dynamic approach from a checkpoint.
+	 * The static approach is not evolved again then: its solution is restored from the checkpoint.
+	 * @return	<code>true</code> if the run resumes the dynamic approach, <code>false</code> otherwise.
+	 */
+	bool resumesDynamicGA(void) const;
+
+	/**
+	 * @brief Restore the static solution kept by the dynamic checkpoint.
+	 * @return	<code>0</code> if the static solution is restored,
+	 * 			<code>1</code> otherwise.
+	 */
+	int restoreStaticSolution(void);
+
 
 	//............................................................. Dynamic approach methods ...
 	/**
@@ -199,6 +249,17 @@ public:
 	 */
 	int buildGADynObjectiveData(void);
 
+	/**
+	 * Compute the fingerprint of the scenario simulated by the dynamic approach: the network,
+	 * route and induction loop files, the routes of the vehicles, the goal detector flows and
+	 * the simulator settings. It keys the simulation result store.
+	 * @param evaluator		The simulator evaluating the genomes: <code>sumo</code> or <code>meso</code>.
+	 * @param fingerprint	The scenario fingerprint, set on success.
+	 * @return	<code>0</code> if the fingerprint is computed, <code>1</code> otherwise.
+	 * @see GARSimResultStore
+	 */
+	int computeSimFingerprint(const std::string& evaluator, common::Hash128& fingerprint) const;
+
 	/**
 	 * Build the genome encoding the dynamic approach.
 	 * The genome is an allele set array where each gene depicts a route from any origin
@@ -308,6 +369,27 @@ public:
 	 */
 	int setGAReplacementScheme(GAGeneticAlgorithm* pGA);
 
+	/**
+	 * @brief Set the number of islands and the migration scheme of an island-model genetic algorithm.
+	 * @param pGA	A pointer to the genetic algorithm.
+	 * @return	<code>0</code> if the island model is successfully set,
+	 * 			<code>1</code> otherwise.
+	 * @see GARIslandGA
+	 */
+	int setGAIslandModel(GAGeneticAlgorithm* pGA);
+
+	/**
+	 * @brief Set the population evaluator of a genetic algorithm.
+	 * The individuals of the population are evaluated concurrently by the given number of threads.
+	 * The islands of an island-model genetic algorithm are stepped concurrently by them instead.
+	 * @param pGA			A pointer to the genetic algorithm.
+	 * @param numThreads	The number of threads evaluating the population.
+	 * @return				<code>0</code> if the population evaluator is successfully set,
+	 * 						<code>1</code> otherwise.
+	 * @see GARPopulationEvaluator
+	 */
+	int setGAPopulationEvaluator(GAGeneticAlgorithm* pGA, int numThreads);
+
 	/**
 	 * @brief Set the parameters that will be used for the genetic algorithm.
 	 * The parameter list object contains information about how genetic algorithms should behave.
@@ -337,23 +419,25 @@ protected:
 	 * Build the network graph used by the k-shortest-path algorithm.
 	 * @return	The network graph used by the k-shortest-path algorithm.
 	 */
-	Graph buildKShortestGraph(void) const;
+	GARKShortestGraph buildKShortestGraph(void) const;
 
 	/**
 	 * Get the k-shortest routes from a source to a sink detector using the Yen's algorithm.
-	 * @param graph			The network graph.
+	 * This method neither logs nor modifies the router, so it can run concurrently
+	 * with distinct Yen's algorithm objects.
+	 * @param kGraph		The network graph.
+	 * @param shortestPaths	The Yen's algorithm on the network graph.
 	 * @param pSourceDet	The pointer to a source detector data.
 	 * @param pSinkDet		The pointer to a sink detector data.
 	 * @param k				The number of k-shortest paths to compute.
-	 * @param kSelected 	The number of selected shortest routes.
 	 * @return				A vector that contains the top k-shortest route descriptions
 	 * 						from a source to a sink detector.
 	 */
-	std::vector<GARRouteDesc> getKShortestRoutes(const Graph& graph,
+	std::vector<GARRouteDesc> getKShortestRoutes(const GARKShortestGraph& kGraph,
+												 CSRYenKShortestPathsAlg& shortestPaths,
 			  	  	  	  	  	  	  	  	     const GARDetector const* pSourceDet,
 											     const GARDetector const* pSinkDet,
-												 int k,
-												 int kSelected) const;
+												 int k) const;
 
 	/**
 	 * Get the selected k-shortest routes randomly.
@@ -379,13 +463,15 @@ protected:
 
 	/**
 	 * Build the description of a shortest route.
+	 * @param kGraph		The network graph.
 	 * @param path			The shortest path data.
 	 * @param sourceEdgeId	The source edge identifier.
 	 * @param sinkEdgeId	The sink edge identifier.
 	 * @param routeNum		The shortest route number from the source to the sink edge.
 	 * @return				An object containing the route data.
 	 */
-	GARRouteDesc buildKShortestRouteDesc(const BasePath const* path,
+	GARRouteDesc buildKShortestRouteDesc(const GARKShortestGraph& kGraph,
+										 const CSRPath& path,
 	  	  	  	  	   	   	   	   	   	 const std::string& sourceEdgeId,
 										 const std::string& sinkEdgeId,
 										 int routeNum) const;
@@ -433,19 +519,105 @@ protected:
 	 */
 	int getGAStatisticsSelectScores(const std::string selectScores) const;
 
+	/**
+	 * @brief Build the gene layout of the static genome.
+	 * The candidate routes and the number of trips of every OD pair are appended
+	 * to the gene layout of the static objective data.
+	 * @return	<code>0</code> if the gene layout is successfully built; <code>1</code> otherwise.
+	 */
+	int buildGAStaticGeneLayout(void);
+
 	/**
 	 * @brief Build the genome allele set array for the static approach.
+	 * Every OD pair of the gene layout contributes one gene per trip, and its genes share
+	 * a single allele set of local route indices.
+	 * @tparam T	The allele type: <code>uint16_t</code>, or <code>uint32_t</code> if some OD pair has more candidate routes.
 	 * @return	The allele set array that comprises the allele sets for every gene in the genome.
 	 */
-	GAAlleleSetArray<const char*> buildGAStaticAlleleSetArray(void);
+	template<class T>
+	GAAlleleSetArray<T> buildGAStaticAlleleSetArray(void);
 
 	/**
-	 * @brief Build the genome allele set for the static approach.
+	 * @brief Get the candidate route names of an OD pair for the static approach.
 	 * @param trips	The trips from a origin to a destination district (TAZ).
-	 * @return		An allele set that comprises all the selected (shortest and longest) routes
+	 * @return		The names of all the selected (shortest and longest) routes
 	 * 				from an edge in the origin district to an edge in the destination district.
 	 */
-	GAAlleleSet<const char*> buildGAStaticAlleleSet(const trip_vector& trips);
+	std::vector<std::string> getStaticCandidateRoutes(const trip_vector& trips);
+
+	/**
+	 * @brief Build the genome allele set for the static approach.
+	 * @param numRoutes	The number of candidate routes of an OD pair.
+	 * @return			An allele set that comprises the local route indices from 0 to numRoutes - 1.
+	 */
+	template<class T>
+	GAAlleleSet<T> buildGAStaticAlleleSet(uint32_t numRoutes);
+
+	/**
+	 * @brief Decode the GA solution for the static approach into route indices.
+	 * A trip genome gives the route selected by every gene, and a count-per-route genome
+	 * gives every candidate route repeated as many times as trips it carries.
+	 * @return	The route indices of the solution for the static approach.
+	 */
+	std::vector<uint32_t> decodeStaticSolution(void) const;
+
+	/**
+	 * @brief Decode a genome of the static approach into route indices.
+	 * @param solution	The genome of the static approach.
+	 * @return	The route indices of the genome.
+	 */
+	std::vector<uint32_t> decodeStaticSolution(const GAGenome& solution) const;
+
+	/**
+	 * @brief Wait for the evaluations still in flight of an asynchronous genetic algorithm,
+	 * and report the utilization of its workers. Other algorithms are left untouched.
+	 * @param pGA	A pointer to the genetic algorithm.
+	 * @see GARAsyncGA
+	 */
+	void stopGAWorkers(GAGeneticAlgorithm* pGA) const;
+
+	/**
+	 * @brief Initialize a genetic algorithm, from the checkpoint if the run resumes its approach.
+	 * A run writing checkpoints is seeded explicitly, so the run resuming it can reseed the random
+	 * generator from the run seed and the checkpoint generation.
+	 * @param pGA		A pointer to the genetic algorithm.
+	 * @param approach	The evolution approach.
+	 * @return	<code>0</code> if the genetic algorithm is initialized,
+	 * 			<code>1</code> otherwise.
+	 */
+	int initializeGA(GAGeneticAlgorithm* pGA, GARCheckpoint::Approach approach);
+
+	/**
+	 * @brief Write the checkpoint of a genetic algorithm if the checkpoint interval is over.
+	 * @param pGA		A pointer to the genetic algorithm.
+	 * @param approach	The evolution approach.
+	 * @return	<code>0</code> if the checkpoint is written or not due,
+	 * 			<code>1</code> if the population can't be checkpointed.
+	 */
+	int checkpointGA(const GAGeneticAlgorithm const* pGA, GARCheckpoint::Approach approach);
+
+	/**
+	 * @brief Publish the best solution found so far if the incumbent interval is over.
+	 * The static approach publishes its route names and trip counts to the 'incumbent-routes-output' file, and
+	 * the dynamic approach its emitters to the 'incumbent-emitters-output' file. The file is written
+	 * aside and renamed, so readers never see a partial solution.
+	 * @param pGA		A pointer to the genetic algorithm.
+	 * @param approach	The evolution approach.
+	 * @param force		Publish even if the interval is not over.
+	 */
+	void publishIncumbent(const GAGeneticAlgorithm const* pGA, GARCheckpoint::Approach approach, bool force);
+
+	/**
+	 * @brief Report the hits and misses of a genome score cache.
+	 * @param pCache	The score cache, or <code>nullptr</code> if the scores are not cached.
+	 */
+	void reportFitnessCache(const GARFitnessCache const* pCache) const;
+
+	/**
+	 * @brief Report the hits, misses and records of the simulation result store.
+	 * @param pStore	The store, or <code>nullptr</code> if the results are not persisted.
+	 */
+	void reportSimStore(GARSimResultStore* pStore) const;
 
 	/**
 	 * @brief Build the genome allele set array for the dynamic approach.
@@ -542,13 +714,13 @@ private:
 	std::unique_ptr<GAGeneticAlgorithm> pGAStatic;
 
 	//! The genome of the GA for the static approach
-	std::unique_ptr<genome_static> pStaticGenome;
+	std::unique_ptr<GAGenome> pStaticGenome;
 
 	//! The data required in the GA objective function for the static approach
 	std::unique_ptr<GARStaticObjData> pStaticObjData;
 
-	//! The solution of the static approach. A list of route names defining the traffic flow.
-	std::unique_ptr<genome_static> pStaticSolution;
+	//! The solution of the static approach. A trip genome or a count-per-route genome.
+	std::unique_ptr<GAGenome> pStaticSolution;
 
 	//! The genetic algorithm for the dynamic approach
 	std::unique_ptr<GAGeneticAlgorithm> pGADyn;
@@ -562,6 +734,36 @@ private:
 	//! The solution of the dynamic approach. A list of route names defining the traffic flow.
 	std::unique_ptr<genome_dyn> pDynSolution;
 
+	//! The SUMO worker sandboxes of the dynamic approach
+	std::unique_ptr<GARSumoWorkerPool> pWorkerPool;
+
+	//! The in-process mesoscopic simulator of the dynamic approach
+	std::unique_ptr<GARMesoSim> pMesoSim;
+
+	//! The induction loop measurement reader of the dynamic approach
+	std::unique_ptr<GARLoopMeasReader> pLoopReader;
+
+	//! The genome score cache of the static approach
+	std::unique_ptr<GARFitnessCache> pStaticCache;
+
+	//! The genome score cache of the dynamic approach
+	std::unique_ptr<GARFitnessCache> pDynCache;
+
+	//! The simulation result store of the dynamic approach
+	std::unique_ptr<GARSimResultStore> pSimStore;
+
+	//! The checkpoint to resume the evolution from
+	std::unique_ptr<GARCheckpoint> pCheckpoint;
+
+	//! The seed of the checkpointed evolution
+	uint32_t gaSeed;
+
+	//! The wall-clock budget terminator, shared by the static and dynamic approaches
+	std::unique_ptr<GARBudgetTerminator> pTerminator;
+
+	//! The time the best solution was last published
+	std::chrono::steady_clock::time_point incumbentTime;
+
 	//! The allele data set (the allele value pattern is <route_name>__<depart_time>)
 	std::vector<std::string> alleles;
 
@@ -0,0 +1,249 @@
+/*
+ * GARAsyncGA.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARAsyncGA.hpp>
+#include <ga/GASStateGA.h>
+#include <ga/garandom.h>
+#include <algorithm>
+
+using std::chrono::steady_clock;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+
+namespace gar {
+
+//................................................. Register the default parameters ...
+GAParameterList& GARAsyncGA::registerDefaultParameters(GAParameterList& params) {
+	return GASteadyStateGA::registerDefaultParameters(params);
+}
+
+
+//................................................. Parameterized constructor ...
+GARAsyncGA::GARAsyncGA(const GAGenome& genome)
+: GAGeneticAlgorithm (genome),
+  inFlight           (0),
+  stopping           (false),
+  error              (nullptr),
+  threads            (1),
+  busyNanos          (0),
+  startTime          (steady_clock::now()) {
+	// Intentionally left empty
+}
+
+//................................................. Destructor ...
+GARAsyncGA::~GARAsyncGA() {
+	stop();
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		stopping = true;
+	}
+	jobCond.notify_all();
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+
+//................................................. Initialize the population ...
+void GARAsyncGA::initialize(unsigned int seed) {
+	GARandomSeed(seed);
+
+	stop();
+	startWorkers();
+	busyNanos = 0;
+	startTime = steady_clock::now();
+
+	// Evaluate the initial population on the workers
+	pop->initialize();
+	for (int i = 0; i < pop->size(); i++) {
+		submit(&pop->individual(i));
+	}
+	for (int i = 0; i < pop->size(); i++) {
+		collect();
+	}
+	rethrow();
+
+	pop->scale();
+	stats.reset(*pop);
+
+	// Keep every worker busy from now on
+	for (unsigned int i = 0; i < threads; i++) {
+		submit(breed());
+	}
+}
+
+
+//................................................. Evolve a generation ...
+void GARAsyncGA::step() {
+	for (int n = 0; n < pop->size(); n++) {
+		GAGenome* pChild = collect();
+		try {
+			rethrow();
+		} catch (...) {
+			delete pChild;
+			throw;
+		}
+
+		// The child takes the place of the worst individual, or it is dropped if it is the worst
+		pop->add(pChild);
+		pop->destroy(GAPopulation::WORST, GAPopulation::RAW);
+		pop->scale();
+
+		submit(breed());
+	}
+
+	stats.update(*pop);
+}
+
+
+//................................................. Stop the evaluations in flight ...
+void GARAsyncGA::stop(void) {
+	std::unique_lock<std::mutex> lock(mtx);
+
+	// The children in flight are owned by the algorithm
+	resultCond.wait(lock, [this] { return results.size() == inFlight; });
+	for (GAGenome* pGenome : results) {
+		delete pGenome;
+	}
+	results.clear();
+	inFlight = 0;
+	error = nullptr;
+}
+
+
+//................................................. Breed a child ...
+GAGenome* GARAsyncGA::breed(void) {
+	GAGenome& mom = pop->select();
+	GAGenome& dad = pop->select();
+
+	GAGenome* pChild = mom.clone();
+	if (sexual() != nullptr && GAFlip(pCrossover())) {
+		(*sexual())(mom, dad, pChild, nullptr);
+	}
+	pChild->mutate(pMutation());
+
+	return pChild;
+}
+
+
+//................................................. Start the worker threads ...
+void GARAsyncGA::startWorkers(void) {
+	if (workers.size() == threads) {
+		return;
+	}
+
+	// Join the workers of another size
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		stopping = true;
+	}
+	jobCond.notify_all();
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+
+	stopping = false;
+	for (unsigned int i = 0; i < threads; i++) {
+		workers.push_back(std::thread(&GARAsyncGA::work, this));
+	}
+}
+
+
+//................................................. The worker thread loop ...
+void GARAsyncGA::work(void) {
+	std::unique_lock<std::mutex> lock(mtx);
+
+	while (true) {
+		jobCond.wait(lock, [this] { return stopping || !jobs.empty(); });
+		if (stopping) {
+			return;
+		}
+
+		GAGenome* pGenome = jobs.front();
+		jobs.pop_front();
+		lock.unlock();
+
+		steady_clock::time_point begin = steady_clock::now();
+		std::exception_ptr failure = nullptr;
+		try {
+			pGenome->evaluate();
+		} catch (...) {
+			failure = std::current_exception();
+		}
+		busyNanos += duration_cast<nanoseconds>(steady_clock::now() - begin).count();
+
+		lock.lock();
+		if (failure != nullptr && error == nullptr) {
+			error = failure;
+		}
+		results.push_back(pGenome);
+		resultCond.notify_all();
+	}
+}
+
+
+//................................................. Submit a genome ...
+void GARAsyncGA::submit(GAGenome* pGenome) {
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		jobs.push_back(pGenome);
+		inFlight++;
+	}
+	jobCond.notify_one();
+}
+
+
+//................................................. Collect an evaluated genome ...
+GAGenome* GARAsyncGA::collect(void) {
+	std::unique_lock<std::mutex> lock(mtx);
+	resultCond.wait(lock, [this] { return !results.empty(); });
+
+	GAGenome* pGenome = results.front();
+	results.pop_front();
+	inFlight--;
+
+	return pGenome;
+}
+
+
+//................................................. Rethrow an evaluation exception ...
+void GARAsyncGA::rethrow(void) {
+	std::exception_ptr failure = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		std::swap(failure, error);
+	}
+	if (failure != nullptr) {
+		std::rethrow_exception(failure);
+	}
+}
+
+
+//................................................. Get the number of worker threads ...
+unsigned int GARAsyncGA::numThreads(void) const {
+	return this->threads;
+}
+
+//................................................. Set the number of worker threads ...
+unsigned int GARAsyncGA::numThreads(unsigned int n) {
+	this->threads = std::max(n, 1u);
+	return this->threads;
+}
+
+//................................................. Get the worker utilization ...
+double GARAsyncGA::utilization(void) const {
+	double elapsed = duration_cast<nanoseconds>(steady_clock::now() - startTime).count();
+	if (elapsed <= 0.0 || threads == 0) {
+		return 0.0;
+	}
+	return std::min(1.0, double(busyNanos.load()) / (elapsed * threads));
+}
+
+} /* namespace gar */
@@ -0,0 +1,95 @@
+/*
+ * GARBudgetTerminator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARBudgetTerminator.hpp>
+#include <ga/GAStatistics.h>
+#include <cmath>
+
+using std::chrono::steady_clock;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+
+namespace gar {
+
+//................................................. Parameterized constructor ...
+GARBudgetTerminator::GARBudgetTerminator(double timeBudget, int stallGenerations, float minImprovement)
+: timeBudget       (timeBudget),
+  stallGenerations (stallGenerations),
+  minImprovement   (std::fabs(minImprovement)),
+  started          (false),
+  deadline         (steady_clock::now()),
+  bestScore        (0.0),
+  improvedAt       (-1) {
+	// Intentionally left empty
+}
+
+
+//................................................. Start the clock ...
+void GARBudgetTerminator::start(void) {
+	if (!started && timeBudget > 0.0) {
+		deadline = steady_clock::now() + duration_cast<steady_clock::duration>(duration<double>(timeBudget));
+	}
+	started = true;
+
+	improvedAt = -1;
+	reason.clear();
+}
+
+
+//................................................. Check the deadline ...
+bool GARBudgetTerminator::expired(void) const {
+	return started && timeBudget > 0.0 && steady_clock::now() >= deadline;
+}
+
+
+//................................................. Get the termination reason ...
+const std::string& GARBudgetTerminator::getReason(void) const {
+	return this->reason;
+}
+
+
+//................................................. The termination function ...
+GABoolean GARBudgetTerminator::TerminateUponBudget(GAGeneticAlgorithm& ga) {
+	if (GAGeneticAlgorithm::TerminateUponGeneration(ga) == gaTrue) {
+		return gaTrue;
+	}
+
+	GARBudgetTerminator* pTerminator = (GARBudgetTerminator*)ga.userData();
+	if (pTerminator == nullptr) {
+		return gaFalse;
+	}
+
+	return pTerminator->terminate(ga) ? gaTrue : gaFalse;
+}
+
+
+//................................................. Check the termination ...
+bool GARBudgetTerminator::terminate(const GAGeneticAlgorithm& ga) {
+	if (expired()) {
+		reason = "time budget spent";
+		return true;
+	}
+
+	// Track the best score in the direction of the optimization
+	const GAStatistics& stats = ga.statistics();
+	float best = (ga.minimaxi() == GAGeneticAlgorithm::MINIMIZE) ? -stats.minEver() : stats.maxEver();
+	bool improved = (best > bestScore && best - bestScore >= minImprovement);
+	if (improvedAt < 0 || ga.generation() < improvedAt || improved) {
+		bestScore = best;
+		improvedAt = ga.generation();
+		return false;
+	}
+
+	if (stallGenerations > 0 && ga.generation() - improvedAt >= stallGenerations) {
+		reason = "best score stalled";
+		return true;
+	}
+
+	return false;
+}
+
+} /* namespace gar */
@@ -0,0 +1,536 @@
+/*
+ * GARCheckpoint.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARCheckpoint.hpp>
+#include <GARStaticObjective.hpp>
+#include <GARGaFactory.hpp>
+#include <HashUtilities.hpp>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+using std::string;
+using std::vector;
+using common::HashUtilities;
+
+namespace gar {
+
+//................................................. Class constants ...
+const char GARCheckpoint::MAGIC[8] = { 'G', 'A', 'R', 'C', 'K', 'P', 'T', '\0' };
+const uint32_t GARCheckpoint::VERSION (2);
+
+
+namespace {
+
+/**
+ * A copy of the statistics of a GAlib genetic algorithm, with access to the counters, the measures,
+ * the convergence history and the best individuals, which GAlib keeps protected and offers no setters for.
+ */
+class CheckpointStatistics : public GAStatistics {
+public:
+	explicit CheckpointStatistics(const GAStatistics& stats)
+	: GAStatistics(stats) {
+		// Intentionally left empty
+	}
+
+	//! Get the generation and the operator counters
+	vector<uint32_t> getCounters(void) const {
+		return { curgen, numsel, numcro, nummut, numrep, numeval, numpeval };
+	}
+
+	//! Set the generation and the operator counters
+	void setCounters(const vector<uint32_t>& counters) {
+		unsigned int* fields[] = { &curgen, &numsel, &numcro, &nummut, &numrep, &numeval, &numpeval };
+		for (size_t k = 0; k < sizeof(fields) / sizeof(fields[0]) && k < counters.size(); k++) {
+			*fields[k] = counters[k];
+		}
+	}
+
+	//! Get the performance measures and the extreme scores ever found
+	vector<float> getMeasures(void) const {
+		return { maxever, minever, on, offmax, offmin };
+	}
+
+	//! Set the performance measures and the extreme scores ever found
+	void setMeasures(const vector<float>& measures) {
+		float* fields[] = { &maxever, &minever, &on, &offmax, &offmin };
+		for (size_t k = 0; k < sizeof(fields) / sizeof(fields[0]) && k < measures.size(); k++) {
+			*fields[k] = measures[k];
+		}
+	}
+
+	//! Get the number of best scores recorded for the convergence
+	uint32_t getNumConvergence(void) const {
+		return nconv;
+	}
+
+	//! Get the best scores of the last generations, as a ring
+	vector<float> getConvergence(void) const {
+		return vector<float>(cscore, cscore + nConvergence());
+	}
+
+	//! Set the convergence history, which only fits the same number of recorded scores
+	bool setConvergence(uint32_t numConvergence, const vector<float>& convergence) {
+		if (convergence.size() != (size_t)nConvergence()) {
+			return false;
+		}
+		std::copy(convergence.begin(), convergence.end(), cscore);
+		nconv = numConvergence;
+		return true;
+	}
+
+	//! Get the best individuals ever found
+	GAPopulation* getBestOfAll(void) {
+		return boa;
+	}
+};
+
+}
+
+
+//................................................. Write a value to a binary stream ...
+template<class T>
+static void writeValue(std::ostream& out, const T& value) {
+	out.write((const char*)&value, sizeof(T));
+}
+
+//................................................. Read a value from a binary stream ...
+template<class T>
+static bool readValue(std::istream& in, T& value) {
+	return (bool)in.read((char*)&value, sizeof(T));
+}
+
+
+//................................................. Parameterized constructor ...
+GARCheckpoint::GARCheckpoint(CLogger* logger)
+: logger     (logger),
+  approach   (STATIC),
+  generation (0),
+  seed       (0) {
+	staticSolution.geneSize = 0;
+	statistics.numConvergence = 0;
+}
+
+
+//................................................. Capture the population ...
+int GARCheckpoint::capture(const GAGeneticAlgorithm& ga, Approach approach, uint32_t generation, uint32_t seed) {
+	const GAPopulation& pop = ga.population();
+
+	this->approach = approach;
+	this->generation = generation;
+	this->seed = seed;
+	individuals.resize(pop.size());
+	scores.resize(pop.size());
+
+	for (int i = 0; i < pop.size(); i++) {
+		if (getGenes(pop.individual(i), individuals[i]) > 0) {
+			logger->error("The genomes of the population can't be checkpointed");
+			return 1;
+		}
+		scores[i] = pop.individual(i).score();
+	}
+
+	// The statistics of the genetic algorithm
+	const GAStatistics& stats = ga.statistics();
+	CheckpointStatistics copy(stats);
+	statistics.counters = copy.getCounters();
+	statistics.measures = copy.getMeasures();
+	statistics.numConvergence = copy.getNumConvergence();
+	statistics.convergence = copy.getConvergence();
+
+	const GAPopulation& best = stats.bestPopulation();
+	statistics.best.resize(best.size());
+	statistics.bestScores.resize(best.size());
+	for (int i = 0; i < best.size(); i++) {
+		if (getGenes(best.individual(i), statistics.best[i]) > 0) {
+			logger->error("The best individuals of the population can't be checkpointed");
+			return 1;
+		}
+		statistics.bestScores[i] = best.individual(i).score();
+	}
+	statistics.scaling = pop.scaling().className();
+	statistics.selection = pop.selector().className();
+
+	if (approach == STATIC) {
+		staticSolution.geneSize = 0;
+		staticSolution.values.clear();
+	}
+
+	return 0;
+}
+
+//................................................. Capture the static solution ...
+int GARCheckpoint::captureStaticSolution(const GAGenome& solution) {
+	if (getGenes(solution, staticSolution) > 0) {
+		logger->error("The static solution can't be checkpointed");
+		return 1;
+	}
+	return 0;
+}
+
+
+//................................................. Write the checkpoint ...
+int GARCheckpoint::save(const string& path) const {
+	string tmpPath = path + ".tmp";
+	std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+	if (!out.is_open()) {
+		logger->error("Unable to open the checkpoint file [" + tmpPath + "]");
+		return 1;
+	}
+
+	auto writeGenes = [&out] (const Genes& genes) {
+		writeValue<uint32_t>(out, genes.geneSize);
+		writeValue<uint32_t>(out, genes.values.size());
+		for (int32_t value : genes.values) {
+			if (genes.geneSize == sizeof(uint16_t)) {
+				writeValue<uint16_t>(out, (uint16_t)value);
+			} else {
+				writeValue<int32_t>(out, value);
+			}
+		}
+	};
+
+	auto writeString = [&out] (const string& text) {
+		writeValue<uint32_t>(out, text.size());
+		out.write(text.data(), text.size());
+	};
+
+	out.write(MAGIC, sizeof(MAGIC));
+	writeValue<uint32_t>(out, VERSION);
+	writeValue<uint8_t>(out, approach);
+	writeValue<uint32_t>(out, generation);
+	writeValue<uint32_t>(out, seed);
+	writeValue<uint32_t>(out, individuals.size());
+	writeGenes(staticSolution);
+	for (size_t i = 0; i < individuals.size(); i++) {
+		writeValue<float>(out, scores[i]);
+		writeGenes(individuals[i]);
+	}
+
+	writeValue<uint32_t>(out, statistics.counters.size());
+	for (uint32_t counter : statistics.counters) {
+		writeValue<uint32_t>(out, counter);
+	}
+	writeValue<uint32_t>(out, statistics.measures.size());
+	for (float measure : statistics.measures) {
+		writeValue<float>(out, measure);
+	}
+	writeValue<uint32_t>(out, statistics.numConvergence);
+	writeValue<uint32_t>(out, statistics.convergence.size());
+	for (float score : statistics.convergence) {
+		writeValue<float>(out, score);
+	}
+	writeValue<uint32_t>(out, statistics.best.size());
+	for (size_t i = 0; i < statistics.best.size(); i++) {
+		writeValue<float>(out, statistics.bestScores[i]);
+		writeGenes(statistics.best[i]);
+	}
+	writeString(statistics.scaling);
+	writeString(statistics.selection);
+
+	out.close();
+	if (!out) {
+		logger->error("Unable to write the checkpoint file [" + tmpPath + "]");
+		return 1;
+	}
+
+	// Replace the previous checkpoint at once
+	if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+		logger->error("Unable to rename the checkpoint file [" + tmpPath + "] to [" + path + "]");
+		return 1;
+	}
+
+	return 0;
+}
+
+
+//................................................. Read the checkpoint ...
+int GARCheckpoint::load(const string& path) {
+	std::ifstream in(path, std::ios::binary);
+	if (!in.is_open()) {
+		logger->error("Unable to open the checkpoint file [" + path + "]");
+		return 1;
+	}
+
+	auto readGenes = [&in] (Genes& genes) {
+		uint32_t count = 0;
+		if (!readValue<uint32_t>(in, genes.geneSize) || !readValue<uint32_t>(in, count)) {
+			return false;
+		}
+		if (genes.geneSize != sizeof(uint16_t) && genes.geneSize != sizeof(int32_t) && count > 0) {
+			return false;
+		}
+		genes.values.resize(count);
+		for (uint32_t k = 0; k < count; k++) {
+			if (genes.geneSize == sizeof(uint16_t)) {
+				uint16_t value = 0;
+				if (!readValue<uint16_t>(in, value)) {
+					return false;
+				}
+				genes.values[k] = value;
+			} else if (!readValue<int32_t>(in, genes.values[k])) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	auto readFloats = [&in] (vector<float>& values) {
+		uint32_t count = 0;
+		if (!readValue<uint32_t>(in, count)) {
+			return false;
+		}
+		values.resize(count);
+		for (uint32_t k = 0; k < count; k++) {
+			if (!readValue<float>(in, values[k])) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	auto readString = [&in] (string& text) {
+		uint32_t length = 0;
+		if (!readValue<uint32_t>(in, length)) {
+			return false;
+		}
+		text.resize(length);
+		return length == 0 || (bool)in.read(&text[0], length);
+	};
+
+	char magic[sizeof(MAGIC)];
+	uint32_t version = 0;
+	uint8_t approachId = 0;
+	uint32_t numIndividuals = 0;
+	in.read(magic, sizeof(magic));
+	if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || !readValue<uint32_t>(in, version) || version != VERSION) {
+		logger->error("The file [" + path + "] is not a checkpoint of version " + std::to_string(VERSION));
+		return 1;
+	}
+
+	bool ok = readValue<uint8_t>(in, approachId)
+			  && readValue<uint32_t>(in, generation)
+			  && readValue<uint32_t>(in, seed)
+			  && readValue<uint32_t>(in, numIndividuals)
+			  && readGenes(staticSolution);
+
+	individuals.resize(ok ? numIndividuals : 0);
+	scores.resize(ok ? numIndividuals : 0);
+	for (uint32_t i = 0; ok && i < numIndividuals; i++) {
+		ok = readValue<float>(in, scores[i]) && readGenes(individuals[i]);
+	}
+
+	uint32_t numCounters = 0;
+	ok = ok && readValue<uint32_t>(in, numCounters);
+	statistics.counters.resize(ok ? numCounters : 0);
+	for (uint32_t k = 0; ok && k < numCounters; k++) {
+		ok = readValue<uint32_t>(in, statistics.counters[k]);
+	}
+	ok = ok && readFloats(statistics.measures)
+			&& readValue<uint32_t>(in, statistics.numConvergence)
+			&& readFloats(statistics.convergence);
+
+	uint32_t numBest = 0;
+	ok = ok && readValue<uint32_t>(in, numBest);
+	statistics.best.resize(ok ? numBest : 0);
+	statistics.bestScores.resize(ok ? numBest : 0);
+	for (uint32_t i = 0; ok && i < numBest; i++) {
+		ok = readValue<float>(in, statistics.bestScores[i]) && readGenes(statistics.best[i]);
+	}
+	ok = ok && readString(statistics.scaling) && readString(statistics.selection);
+
+	if (!ok || approachId > DYNAMIC) {
+		logger->error("The checkpoint file [" + path + "] is truncated or corrupted");
+		return 1;
+	}
+	approach = (Approach)approachId;
+
+	return 0;
+}
+
+
+//................................................. Restore an individual ...
+int GARCheckpoint::restore(GAGenome& genome, int i) const {
+	if (i < 0 || i >= (int)individuals.size() || setGenes(genome, individuals[i]) > 0) {
+		return 1;
+	}
+
+	// Restoring the score marks the genome as evaluated
+	genome.score(scores[i]);
+
+	return 0;
+}
+
+//................................................. Restore the statistics ...
+int GARCheckpoint::restoreStatistics(GAGeneticAlgorithm& ga) const {
+	const GAPopulation& pop = ga.population();
+	if (statistics.scaling != pop.scaling().className() || statistics.selection != pop.selector().className()) {
+		logger->error("The checkpoint was evolved with the [" + statistics.scaling + "] scaling and the ["
+					  + statistics.selection + "] selection, not with the [" + pop.scaling().className()
+					  + "] scaling and the [" + pop.selector().className() + "] selection");
+		return 1;
+	}
+
+	// GAlib only exposes the statistics of the genetic algorithms created by the factory
+	GARCheckpointable* pCheckpointable = dynamic_cast<GARCheckpointable*>(&ga);
+	if (pCheckpointable == nullptr) {
+		logger->error("The statistics of the [" + string(ga.className()) + "] genetic algorithm can't be restored");
+		return 1;
+	}
+
+	GAStatistics& stats = pCheckpointable->restorableStatistics();
+	CheckpointStatistics restored(stats);
+	restored.setCounters(statistics.counters);
+	restored.setMeasures(statistics.measures);
+	if (!restored.setConvergence(statistics.numConvergence, statistics.convergence)) {
+		logger->warning("The convergence history of the checkpoint doesn't fit the number of convergence generations");
+	}
+
+	// The best individuals ever found replace those of the restored population
+	GAPopulation* pBest = restored.getBestOfAll();
+	if (pBest != nullptr) {
+		for (int i = 0; i < pBest->size() && i < (int)statistics.best.size(); i++) {
+			if (setGenes(pBest->individual(i), statistics.best[i]) == 0) {
+				pBest->individual(i).score(statistics.bestScores[i]);
+			}
+		}
+		pBest->touch();
+		pBest->sort(gaTrue);
+	}
+	stats = restored;
+
+	// The scaling and the selection follow from the restored scores
+	pop.scale(gaTrue);
+
+	return 0;
+}
+
+
+//................................................. Restore the static solution ...
+int GARCheckpoint::restoreStaticSolution(GAGenome& genome) const {
+	if (staticSolution.values.empty()) {
+		return 1;
+	}
+	return setGenes(genome, staticSolution);
+}
+
+
+//................................................. The population initializer ...
+void GARCheckpoint::PopulationInitializer(GAPopulation& pop) {
+	const GARCheckpoint* pCheckpoint = (const GARCheckpoint*)pop.userData();
+
+	for (int i = 0; i < pop.size(); i++) {
+		GAGenome& genome = pop.individual(i);
+		if (pCheckpoint == nullptr || pCheckpoint->restore(genome, i) > 0) {
+			genome.initialize();
+		}
+	}
+}
+
+
+//................................................. Derive the seed after a checkpoint ...
+uint32_t GARCheckpoint::deriveSeed(uint32_t seed, uint32_t generation) {
+	uint32_t words[2] = { seed, generation };
+	uint32_t derived = (uint32_t)HashUtilities::hash128(words, sizeof(words)).lo;
+	return (derived != 0) ? derived : 1;
+}
+
+
+//................................................. Read the genes of a genome ...
+int GARCheckpoint::getGenes(const GAGenome& genome, Genes& genes) {
+	const GA1DArrayGenome<uint16_t>* pShort = dynamic_cast<const GA1DArrayGenome<uint16_t>*>(&genome);
+	if (pShort != nullptr) {
+		genes.geneSize = sizeof(uint16_t);
+		genes.values.resize(pShort->length());
+		for (int k = 0; k < pShort->length(); k++) {
+			genes.values[k] = pShort->gene(k);
+		}
+		return 0;
+	}
+
+	const GA1DArrayGenome<uint32_t>* pWide = dynamic_cast<const GA1DArrayGenome<uint32_t>*>(&genome);
+	if (pWide != nullptr) {
+		genes.geneSize = sizeof(uint32_t);
+		genes.values.resize(pWide->length());
+		for (int k = 0; k < pWide->length(); k++) {
+			genes.values[k] = (int32_t)pWide->gene(k);
+		}
+		return 0;
+	}
+
+	const GA1DArrayGenome<int>* pInt = dynamic_cast<const GA1DArrayGenome<int>*>(&genome);
+	if (pInt != nullptr) {
+		genes.geneSize = sizeof(int32_t);
+		genes.values.resize(pInt->length());
+		for (int k = 0; k < pInt->length(); k++) {
+			genes.values[k] = pInt->gene(k);
+		}
+		return 0;
+	}
+
+	return 1;
+}
+
+//................................................. Write the genes of a genome ...
+int GARCheckpoint::setGenes(GAGenome& genome, const Genes& genes) {
+	GA1DArrayGenome<uint16_t>* pShort = dynamic_cast<GA1DArrayGenome<uint16_t>*>(&genome);
+	if (pShort != nullptr && genes.geneSize == sizeof(uint16_t) && pShort->length() == (int)genes.values.size()) {
+		for (int k = 0; k < pShort->length(); k++) {
+			pShort->gene(k, (uint16_t)genes.values[k]);
+		}
+		GARStaticObjective::invalidateEvalData(genome);
+		return 0;
+	}
+
+	GA1DArrayGenome<uint32_t>* pWide = dynamic_cast<GA1DArrayGenome<uint32_t>*>(&genome);
+	if (pWide != nullptr && genes.geneSize == sizeof(uint32_t) && pWide->length() == (int)genes.values.size()) {
+		for (int k = 0; k < pWide->length(); k++) {
+			pWide->gene(k, (uint32_t)genes.values[k]);
+		}
+		GARStaticObjective::invalidateEvalData(genome);
+		return 0;
+	}
+
+	GA1DArrayGenome<int>* pInt = dynamic_cast<GA1DArrayGenome<int>*>(&genome);
+	if (pInt != nullptr && genes.geneSize == sizeof(int32_t) && pInt->length() == (int)genes.values.size()) {
+		for (int k = 0; k < pInt->length(); k++) {
+			pInt->gene(k, genes.values[k]);
+		}
+		return 0;
+	}
+
+	return 1;
+}
+
+
+//................................................. Get the evolution approach ...
+GARCheckpoint::Approach GARCheckpoint::getApproach(void) const {
+	return this->approach;
+}
+
+//................................................. Get the generation ...
+uint32_t GARCheckpoint::getGeneration(void) const {
+	return this->generation;
+}
+
+//................................................. Get the seed ...
+uint32_t GARCheckpoint::getSeed(void) const {
+	return this->seed;
+}
+
+//................................................. Get the population size ...
+int GARCheckpoint::getPopulationSize(void) const {
+	return this->individuals.size();
+}
+
+//................................................. Check for the static solution ...
+bool GARCheckpoint::hasStaticSolution(void) const {
+	return !this->staticSolution.values.empty();
+}
+
+} /* namespace gar */
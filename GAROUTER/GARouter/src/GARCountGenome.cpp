@@ -0,0 +1,199 @@
+/*
+ * GARCountGenome.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARCountGenome.hpp>
+#include <GARStaticObjData.hpp>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+using std::vector;
+
+namespace gar {
+
+//................................................. Parameterized constructor ...
+GARCountGenome::GARCountGenome(const GARStaticObjData const* pData, GAGenome::Evaluator f)
+: GA1DArrayGenome<int>(pData->getOdRoutes().size(), f, (void*)pData) {
+	initializer(GARCountGenome::Initializer);
+	mutator(GARCountGenome::Mutator);
+	crossover(GARCountGenome::Crossover);
+	comparator(GARCountGenome::Comparator);
+}
+
+//................................................. Copy constructor ...
+GARCountGenome::GARCountGenome(const GARCountGenome& other)
+: GA1DArrayGenome<int>(other) {
+	// Intentionally left empty
+}
+
+//................................................. Clone the genome ...
+GAGenome* GARCountGenome::clone(GAGenome::CloneMethod flag) const {
+	GARCountGenome* pCopy = new GARCountGenome(*this);
+	if (flag != CONTENTS) {
+		for (int i = 0; i < pCopy->length(); i++) {
+			pCopy->gene(i, 0);
+		}
+	}
+	return pCopy;
+}
+
+
+//................................................. The initialization operator ...
+void GARCountGenome::Initializer(GAGenome& g) {
+	GARCountGenome& genome = (GARCountGenome&)g;
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+	const vector<uint32_t>& offsets = pData->getOdRouteOffsets();
+
+	for (uint32_t od = 0; od < pData->getNumOds(); od++) {
+		uint32_t first = offsets[od];
+		uint32_t count = offsets[od + 1] - first;
+
+		for (uint32_t k = first; k < offsets[od + 1]; k++) {
+			genome.gene(k, 0);
+		}
+		if (count == 0) {
+			continue;
+		}
+
+		// Assign every trip to a random candidate route
+		for (uint32_t t = 0; t < pData->getOdTrips(od); t++) {
+			uint32_t k = first + GARandomInt(0, count - 1);
+			genome.gene(k, genome.gene(k) + 1);
+		}
+	}
+}
+
+
+//................................................. The mutation operator ...
+int GARCountGenome::Mutator(GAGenome& g, float pmut) {
+	GARCountGenome& genome = (GARCountGenome&)g;
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+	const vector<uint32_t>& offsets = pData->getOdRouteOffsets();
+
+	if (pmut <= 0.0) {
+		return 0;
+	}
+
+	int nMut = 0;
+
+	for (uint32_t od = 0; od < pData->getNumOds(); od++) {
+		uint32_t first = offsets[od];
+		uint32_t count = offsets[od + 1] - first;
+		if (count < 2) {
+			continue;
+		}
+
+		for (uint32_t k = first; k < offsets[od + 1]; k++) {
+			int trips = genome.gene(k);
+			if (trips == 0 || !GAFlip(pmut)) {
+				continue;
+			}
+
+			// Move a share of the route trips to another candidate route of the OD pair
+			int moved = GARandomInt(1, (trips + 1) / 2);
+			uint32_t other = first + GARandomInt(0, count - 2);
+			if (other >= k) {
+				other++;
+			}
+
+			genome.gene(k, trips - moved);
+			genome.gene(other, genome.gene(other) + moved);
+			nMut++;
+		}
+	}
+
+	return nMut;
+}
+
+
+//................................................. The crossover operator ...
+int GARCountGenome::Crossover(const GAGenome& mom, const GAGenome& dad, GAGenome* bro, GAGenome* sis) {
+	const GARCountGenome& m = (const GARCountGenome&)mom;
+	const GARCountGenome& d = (const GARCountGenome&)dad;
+	const GARStaticObjData const* pData = (GARStaticObjData*)m.userData();
+	const vector<uint32_t>& offsets = pData->getOdRouteOffsets();
+
+	if (bro == nullptr && sis == nullptr) {
+		return 0;
+	}
+
+	for (uint32_t od = 0; od < pData->getNumOds(); od++) {
+		double alpha = GARandomFloat();
+
+		if (bro != nullptr) {
+			blend((GARCountGenome&)*bro, m, d, alpha, offsets[od], offsets[od + 1], pData->getOdTrips(od));
+		}
+		if (sis != nullptr) {
+			blend((GARCountGenome&)*sis, m, d, 1.0 - alpha, offsets[od], offsets[od + 1], pData->getOdTrips(od));
+		}
+	}
+
+	return (bro != nullptr ? 1 : 0) + (sis != nullptr ? 1 : 0);
+}
+
+
+//................................................. Blend the route counts of an OD pair ...
+void GARCountGenome::blend(GARCountGenome& child,
+						   const GARCountGenome& mom,
+						   const GARCountGenome& dad,
+						   double alpha,
+						   uint32_t first,
+						   uint32_t last,
+						   uint32_t trips) {
+	static thread_local vector<std::pair<double, uint32_t>> remainders;
+	remainders.clear();
+
+	if (first == last) {
+		return;
+	}
+
+	// Round the blended counts down
+	uint32_t assigned = 0;
+	for (uint32_t k = first; k < last; k++) {
+		double value = alpha * mom.gene(k) + (1.0 - alpha) * dad.gene(k);
+		int count = (int)value;
+		child.gene(k, count);
+		assigned += count;
+		remainders.push_back(std::make_pair(value - count, k));
+	}
+
+	// Give the trips lost by the rounding to the routes with the largest remainders
+	uint32_t missing = (trips > assigned) ? trips - assigned : 0;
+	missing = std::min<uint32_t>(missing, remainders.size());
+	std::partial_sort(remainders.begin(), remainders.begin() + missing, remainders.end(),
+					  [](const std::pair<double, uint32_t>& a, const std::pair<double, uint32_t>& b) {
+						  return a.first > b.first;
+					  });
+	for (uint32_t i = 0; i < missing; i++) {
+		uint32_t k = remainders[i].second;
+		child.gene(k, child.gene(k) + 1);
+	}
+}
+
+
+//................................................. The genome comparator ...
+float GARCountGenome::Comparator(const GAGenome& g1, const GAGenome& g2) {
+	const GARCountGenome& genome1 = (const GARCountGenome&)g1;
+	const GARCountGenome& genome2 = (const GARCountGenome&)g2;
+
+	// Every trip moved from a route to another one is counted twice
+	long diff = 0;
+	long trips = 0;
+	for (int i = 0; i < genome1.length(); i++) {
+		diff += std::labs(long(genome1.gene(i)) - long(genome2.gene(i)));
+		trips += genome1.gene(i);
+	}
+
+	if (trips == 0) {
+		return 0.0;
+	}
+
+	// Return a number between 0 (same) and 1 (entirely different)
+	return float(diff) / float(2 * trips);
+}
+
+} /* namespace gar */
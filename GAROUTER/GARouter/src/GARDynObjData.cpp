@@ -19,6 +19,12 @@ GARDynObjData::GARDynObjData(CLogger* logger)
   rouFile  (""),
   emitFile (""),
   loopFile (""),
+  sumoBinary ("sumo"),
+  pWorkerPool (nullptr),
+  pMesoSim (nullptr),
+  pLoopReader (nullptr),
+  pFitnessCache (nullptr),
+  pSimStore (nullptr),
   begin	   (0),
   end	   (86400),
   offset   (0),
@@ -59,6 +65,36 @@ std::string GARDynObjData::getLoopFile(void) const {
 	return this->loopFile;
 }
 
+//................................................. Get the SUMO executable ...
+std::string GARDynObjData::getSumoBinary(void) const {
+	return this->sumoBinary;
+}
+
+//................................................. Get the SUMO worker pool ...
+GARSumoWorkerPool* GARDynObjData::getpWorkerPool(void) const {
+	return this->pWorkerPool;
+}
+
+//................................................. Get the mesoscopic simulator ...
+const GARMesoSim const* GARDynObjData::getpMesoSim(void) const {
+	return this->pMesoSim;
+}
+
+//................................................. Get the loop measurement reader ...
+const GARLoopMeasReader const* GARDynObjData::getpLoopReader(void) const {
+	return this->pLoopReader;
+}
+
+//................................................. Get the genome score cache ...
+GARFitnessCache* GARDynObjData::getpFitnessCache(void) const {
+	return this->pFitnessCache;
+}
+
+//................................................. Get the simulation result store ...
+GARSimResultStore* GARDynObjData::getpSimStore(void) const {
+	return this->pSimStore;
+}
+
 //................................................. Get the beginning time ...
 SUMOTime GARDynObjData::getBegin(void) const {
 	return this->begin;
@@ -139,6 +175,36 @@ void GARDynObjData::setLoopFile(const std::string& loopFile) {
 	this->loopFile = loopFile;
 }
 
+//................................................. Set the SUMO executable ...
+void GARDynObjData::setSumoBinary(const std::string& sumoBinary) {
+	this->sumoBinary = sumoBinary;
+}
+
+//................................................. Set the SUMO worker pool ...
+void GARDynObjData::setpWorkerPool(GARSumoWorkerPool* pWorkerPool) {
+	this->pWorkerPool = pWorkerPool;
+}
+
+//................................................. Set the mesoscopic simulator ...
+void GARDynObjData::setpMesoSim(const GARMesoSim const* pMesoSim) {
+	this->pMesoSim = pMesoSim;
+}
+
+//................................................. Set the genome score cache ...
+void GARDynObjData::setpFitnessCache(GARFitnessCache* pFitnessCache) {
+	this->pFitnessCache = pFitnessCache;
+}
+
+//................................................. Set the simulation result store ...
+void GARDynObjData::setpSimStore(GARSimResultStore* pSimStore) {
+	this->pSimStore = pSimStore;
+}
+
+//................................................. Set the loop measurement reader ...
+void GARDynObjData::setpLoopReader(const GARLoopMeasReader const* pLoopReader) {
+	this->pLoopReader = pLoopReader;
+}
+
 //................................................. Set the beginning time ...
 void GARDynObjData::setBegin(const SUMOTime& begin) {
 	this->begin = begin;
@@ -190,11 +256,8 @@ void GARDynObjData::setpDetFlows(const GARDetectorFlows const* pDetFlows) {
 }
 
 //................................................. Set the solution genome from the static GA ...
-void GARDynObjData::setRoutesSolution(const gar::genome_static& genomeSolution) {
-	for (int i = 0; i < genomeSolution.size(); i++) {
-		string routeName = string(genomeSolution.gene(i));
-		routesSolution.push_back(routeName);
-	}
+void GARDynObjData::setRoutesSolution(const std::vector<std::string>& routeNames) {
+	this->routesSolution = routeNames;
 }
 
 //................................................. Add an entry in the loop2det map ...
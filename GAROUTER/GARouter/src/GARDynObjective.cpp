@@ -7,16 +7,16 @@
 
 #include <GARDynObjective.hpp>
 #include <GARDynObjData.hpp>
+#include <GARLoopMeasReader.hpp>
 #include <GARUtils.hpp>
 #include <router/ROEdge.h>
 #include <StringUtilities.hpp>
-#include <FileUtils.hpp>
 #include <boost/format.hpp>
 #include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/xml_parser.hpp>
+#include <boost/filesystem.hpp>
 #include <vector>
+#include <cstdio>
 #include <iostream>
 #include <algorithm>
 
@@ -30,7 +30,7 @@ using std::shared_ptr;
 using std::unique_ptr;
 using common::StringUtilities;
 
-namespace boost_pt = boost::property_tree;
+namespace boost_fs = boost::filesystem;
 
 
 namespace gar {
@@ -42,16 +42,125 @@ const std::string GARDynObjective::GAR_ALLELE_DEPART_SEPARATOR ("__");
 
 //................................................. The genome objective function ...
 float GARDynObjective::objective(GAGenome& __genome) {
-	float score = 0.0;
-
 	// Cast to the suitable genome
 	genome_dyn& genome = (genome_dyn&)__genome;
 
 	// Get the data required by the objective from the genome user data
 	const GARDynObjData const* pData = (GARDynObjData*)genome.userData();
 
+	// Return the score of the departure times already simulated
+	GARFitnessCache* pCache = pData->getpFitnessCache();
+	if (pCache == nullptr && pData->getpSimStore() == nullptr) {
+		return scoreGenome(genome, pData, Hash128());
+	}
+
+	Hash128 key = genomeKey(genome);
+	float score = 0.0;
+	if (pCache != nullptr && pCache->find(key, score)) {
+		return score;
+	}
+
+	score = scoreGenome(genome, pData, key);
+	if (pCache != nullptr) {
+		pCache->insert(key, score);
+	}
+
+	return score;
+}
+
+
+//................................................. Score a genome ...
+float GARDynObjective::scoreGenome(const genome_dyn& genome,
+								   const GARDynObjData const* pData,
+								   const Hash128& key) {
+	// Reuse the detector flows simulated by a previous run
+	GARSimResultStore* pStore = pData->getpSimStore();
+	shared_ptr<GARDetectorFlows> pSimFlowData = nullptr;
+	if (pStore != nullptr) {
+		pSimFlowData = pStore->find(key);
+	}
+
+	if (pSimFlowData == nullptr) {
+		pSimFlowData = simulate(genome, pData);
+		if (pSimFlowData == nullptr) {
+			return 0.0;
+		}
+		if (pStore != nullptr) {
+			pStore->insert(key, *pSimFlowData);
+		}
+	}
+
+	return computeScore(pData->getpDetCont()->getDetectors(),
+						pData->getpDetFlows(),
+						pSimFlowData.get());
+}
+
+
+//................................................. Simulate a genome ...
+shared_ptr<GARDetectorFlows> GARDynObjective::simulate(const genome_dyn& genome,
+													   const GARDynObjData const* pData) {
+	// Run the in-process simulation if it replaces SUMO
+	if (pData->getpMesoSim() != nullptr) {
+		return simulateMeso(genome, pData);
+	}
+
+	// Run the simulation on the shared files if there are no worker sandboxes
+	GARSumoWorkerPool* pPool = pData->getpWorkerPool();
+	if (pPool == nullptr) {
+		return simulateSUMO(genome, pData, pData->getLoopFile(), pData->getEmitFile(), "");
+	}
+
+	// Run the simulation on the files of an idle worker sandbox
+	const GARSumoSandbox* pSandbox = pPool->acquire();
+	shared_ptr<GARDetectorFlows> pSimFlowData = nullptr;
+	try {
+		pSimFlowData = simulateSUMO(genome, pData, pSandbox->loopFile, pSandbox->emitFile, pSandbox->measFile);
+	} catch (...) {
+		pPool->release(pSandbox);
+		throw;
+	}
+	pPool->release(pSandbox);
+
+	return pSimFlowData;
+}
+
+
+//................................................. Compute the hash key of the genome genes ...
+Hash128 GARDynObjective::genomeKey(const genome_dyn& genome) {
+	vector<int> genes(genome.size());
+	for (int i = 0; i < genome.size(); i++) {
+		genes[i] = genome.gene(i);
+	}
+	return GARFitnessCache::key(genes.data(), genes.size());
+}
+
+
+//................................................. Evaluate a genome with a SUMO simulation ...
+float GARDynObjective::evaluate(const genome_dyn& genome,
+								const GARDynObjData const* pData,
+								const string& loopFile,
+								const string& emitFile,
+								const string& measFile) {
+	shared_ptr<GARDetectorFlows> pSimFlowData = simulateSUMO(genome, pData, loopFile, emitFile, measFile);
+	if (pSimFlowData == nullptr) {
+		return 0.0;
+	}
+
+	// Evaluate the score of the SUMO simulation
+	return computeScore(pData->getpDetCont()->getDetectors(),
+						pData->getpDetFlows(),
+						pSimFlowData.get());
+}
+
+
+//................................................. Simulate a genome with SUMO ...
+shared_ptr<GARDetectorFlows> GARDynObjective::simulateSUMO(const genome_dyn& genome,
+														   const GARDynObjData const* pData,
+														   const string& loopFile,
+														   const string& emitFile,
+														   const string& measFile) {
 	// Write the emitter file
-	int status = writeEmitterFile(pData->getEmitFile(),
+	int status = writeEmitterFile(emitFile,
 					 	 	 	  pData->getBegin(),
 								  pData->getEnd(),
 								  pData->getTimeStep(),
@@ -61,36 +170,77 @@ float GARDynObjective::objective(GAGenome& __genome) {
 								  pData->getRoutesSolution(),
 								  genome);
 
-	// If writeEmitterFile fails, return 0.0 score
+	// If writeEmitterFile fails, there are no flows
 	if (status > 0) {
-		return 0.0;
+		return nullptr;
 	}
 
-	SUMOTime endTime = runSUMO(pData->getNetFile(),
-							   pData->getLoopFile(),
+	// Discard the measurements of the previous simulation
+	if (!measFile.empty()) {
+		std::remove(measFile.c_str());
+	}
+
+	SUMOTime endTime = runSUMO(pData->getSumoBinary(),
+							   pData->getNetFile(),
+							   loopFile,
 							   pData->getRouFile(),
-							   pData->getEmitFile(),
+							   emitFile,
 							   pData->getBegin(),
 							   pData->getTimeToTeleport());
 
 	if (endTime < 0) {
 		std::cerr << "SUMO simulation failed" << std::endl;
-		return 0.0;
+		return nullptr;
 	}
 
+	// The measures file is written next to the shared induction loop file
+	string loopMeasFile = measFile;
+	if (loopMeasFile.empty()) {
+		loopMeasFile = (boost_fs::path(loopFile).parent_path() / GAR_LOOP_MEAS_FILE).string();
+	}
 
 	// Read measurements from induction loop measure file
-	shared_ptr<GARDetectorFlows> pSimFlowData = readLoopMeasures(pData->getLoops2Detectors(),
-															 	 pData->getBegin(),
-																 pData->getEnd(),
-																 pData->getTimeStep());
+	if (pData->getpLoopReader() != nullptr) {
+		return pData->getpLoopReader()->read(loopMeasFile);
+	}
+	return readLoopMeasures(loopMeasFile,
+							pData->getLoops2Detectors(),
+							pData->getBegin(),
+							pData->getEnd(),
+							pData->getTimeStep());
+}
 
-	// Evaluate the score of the SUMO simulation
-	score = computeScore(pData->getpDetCont()->getDetectors(),
-						 pData->getpDetFlows(),
-						 pSimFlowData.get());
 
-	return score;
+//................................................. Evaluate a genome with the mesoscopic simulator ...
+float GARDynObjective::evaluateMeso(const genome_dyn& genome,
+									const GARDynObjData const* pData) {
+	shared_ptr<GARDetectorFlows> pSimFlowData = simulateMeso(genome, pData);
+	if (pSimFlowData == nullptr) {
+		return 0.0;
+	}
+
+	// Evaluate the score of the mesoscopic simulation
+	return computeScore(pData->getpDetCont()->getDetectors(),
+						pData->getpDetFlows(),
+						pSimFlowData.get());
+}
+
+
+//................................................. Simulate a genome with the mesoscopic simulator ...
+shared_ptr<GARDetectorFlows> GARDynObjective::simulateMeso(const genome_dyn& genome,
+														   const GARDynObjData const* pData) {
+	// The depart times of the vehicles are the genes
+	vector<int> departs(genome.size());
+	for (int i = 0; i < genome.size(); i++) {
+		departs[i] = genome.gene(i);
+	}
+
+	shared_ptr<GARDetectorFlows> pSimFlowData = pData->getpMesoSim()->simulate(pData->getRoutesSolution(), departs);
+	if (pSimFlowData == nullptr) {
+		std::cerr << "Mesoscopic simulation failed" << std::endl;
+	}
+
+	return pSimFlowData;
 }
 
 
@@ -126,7 +276,7 @@ int GARDynObjective::writeEmitterFile(const string& emittFilename,
 			continue;
 		}
 
-		std::shared_ptr<const GARRouteDesc> pRd = pRouCont->getRouteDesc(routeName);
+		const GARRouteDesc* pRd = pRouCont->getRouteDesc(routeName);
 		if (pRd == nullptr) {
 			std::cerr << "Warning: Unable to find route [" << routeName << "] in the routes container" << std::endl;
 			return 1;
@@ -157,7 +307,8 @@ int GARDynObjective::writeEmitterFile(const string& emittFilename,
 
 
 //................................................. Run the SUMO simulation ...
-int GARDynObjective::runSUMO(const std::string& netFile,
+int GARDynObjective::runSUMO(const std::string& sumoBinary,
+							 const std::string& netFile,
 		   	   	   	  	  	 const std::string& loopFile,
 							 const std::string& rouFile,
 							 const std::string& emittFile,
@@ -167,7 +318,7 @@ int GARDynObjective::runSUMO(const std::string& netFile,
 	FILE *fp;
 	char buff[512];
 
-	string sumoCommand = string("sumo") +
+	string sumoCommand = sumoBinary +
 						 " --net-file " + netFile +
 						 " --additional-files " + loopFile + "," + rouFile + "," + emittFile +
 						 " --begin " + StringUtilities::toString<SUMOTime>(begin) +
@@ -222,78 +373,14 @@ SUMOTime GARDynObjective::getSimulationEndTime(FILE* fp) {
 
 
 //................................................. Read the induction loop measurements ...
-std::shared_ptr<GARDetectorFlows> GARDynObjective::readLoopMeasures(const gar::loop2det_map& loops2Dets,
+std::shared_ptr<GARDetectorFlows> GARDynObjective::readLoopMeasures(const std::string& measFile,
+																	const gar::loop2det_map& loops2Dets,
 							   	   	   	    			     	    const SUMOTime& beginTime,
 																    const SUMOTime& endTime,
 																    const SUMOTime& timeStep) {
-	// Create the detector flows data
-	std::shared_ptr<GARDetectorFlows> pDetFlows = std::make_shared<GARDetectorFlows>(beginTime, endTime, timeStep);
-
-	// Find the measures file
-	string measFile;
-	common::FileUtils::findFile("RTGAR",
-								GAR_LOOP_MEAS_FILE,
-								measFile);
-
-    using boost::property_tree::ptree;
-    try {
- 		// Create empty property tree object
-		boost_pt::ptree tree;
-
-		// Parse the XML into the property tree.
-		boost_pt::read_xml(measFile, tree);
-
-		// Traverse the property tree to get the induction loop measurements
-		for (const ptree::value_type& interval : tree.get_child("detector")) {
-			if (interval.first != "interval") {
-				continue;
-			}
-
-			// Get the measurement attributes
-			string id 		= interval.second.get<string>("<xmlattr>.id", "");
-			SUMOTime begin 	= (int)StringUtilities::toFloat(interval.second.get<string>("<xmlattr>.begin", ""));
-			int nVehContrib = StringUtilities::toInt(interval.second.get<string>("<xmlattr>.nVehContrib", "0"));
-			float speed 	= StringUtilities::toFloat(interval.second.get<string>("<xmlattr>.speed", "-1.00"));
-
-			// Discard measurements later than the end time
-			if (begin > endTime) {
-				continue;
-			}
-
-			// Get the detector data corresponding to the induction loop
-			auto it = loops2Dets.find(id);
-			if (it == loops2Dets.end()) {
-				std::cerr << "Can't find detector for induction loop [" << id << "]" << std::endl;
-				continue;
-			}
-			string detectorId = (it->second)->getID();
-
-			FlowDef fd;
-			fd.qPKW  = nVehContrib;
-			fd.vPKW  = speed;
-			fd.qLKW  = 0.0;
-			fd.vLKW  = 0.0;
-			fd.isLKW = 0.0;
-			fd.fLKW  = 0.0;
-			fd.firstSet = false;
-
-			pDetFlows->addFlow(detectorId, begin, fd);
-		}
-    } catch (boost_pt::ptree_bad_data& ex) {
-    	std::cerr << "Bad data exception caught while loading flow measures from file '" << GAR_LOOP_MEAS_FILE << "':" << string(ex.what()) << std::endl;
-    	return nullptr;
-    } catch (boost_pt::ptree_bad_path& ex) {
-    	std::cerr << "Bad path exception caught while loading flow measures from file '" << GAR_LOOP_MEAS_FILE << "':" << string(ex.what()) << std::endl;
-    	return nullptr;
-    } catch (boost_pt::ptree_error& ex) {
-    	std::cerr << "Unknown exception caught while loading flow measures from file '" << GAR_LOOP_MEAS_FILE << "':" << string(ex.what()) << std::endl;
-    	return nullptr;
-    } catch (common::StringUtilsException& ex) {
-    	std::cerr << "Fail to read induction loop measurements from file '" << GAR_LOOP_MEAS_FILE << "':" << ex.getReason() << std::endl;
-    	return nullptr;
-    }
+	GARLoopMeasReader reader (loops2Dets, beginTime, endTime, timeStep);
 
-    return pDetFlows;
+	return reader.read(measFile);
 }
 
 
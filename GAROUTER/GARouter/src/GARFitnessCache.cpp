@@ -0,0 +1,91 @@
+/*
+ * GARFitnessCache.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARFitnessCache.hpp>
+
+namespace gar {
+
+//................................................. Class constants ...
+const size_t GARFitnessCache::NUM_SHARDS (16);
+
+
+//................................................. Parameterized constructor ...
+GARFitnessCache::GARFitnessCache(size_t capacity)
+: shardCapacity ((capacity + NUM_SHARDS - 1) / NUM_SHARDS),
+  shards        (new Shard[NUM_SHARDS]),
+  hits          (0),
+  misses        (0) {
+	if (shardCapacity == 0) {
+		shardCapacity = 1;
+	}
+	for (size_t i = 0; i < NUM_SHARDS; i++) {
+		shards[i].scores.reserve(shardCapacity);
+		shards[i].ring.reserve(shardCapacity);
+		shards[i].next = 0;
+	}
+}
+
+//................................................. Get the shard of a key ...
+GARFitnessCache::Shard& GARFitnessCache::shard(const Hash128& key) {
+	return shards[key.hi % NUM_SHARDS];
+}
+
+//................................................. Look up the score of a genome ...
+bool GARFitnessCache::find(const Hash128& key, float& score) {
+	Shard& s = shard(key);
+	{
+		std::lock_guard<std::mutex> lock(s.mtx);
+		auto it = s.scores.find(key);
+		if (it != s.scores.end()) {
+			score = it->second;
+			hits++;
+			return true;
+		}
+	}
+
+	misses++;
+	return false;
+}
+
+//................................................. Store the score of a genome ...
+void GARFitnessCache::insert(const Hash128& key, float score) {
+	Shard& s = shard(key);
+	std::lock_guard<std::mutex> lock(s.mtx);
+
+	// Another thread may have scored the same genes meanwhile
+	if (!s.scores.insert(std::make_pair(key, score)).second) {
+		return;
+	}
+
+	// Record the key, evicting the oldest one when the shard is full
+	if (s.ring.size() < shardCapacity) {
+		s.ring.push_back(key);
+		return;
+	}
+
+	s.scores.erase(s.ring[s.next]);
+	s.ring[s.next] = key;
+	s.next = (s.next + 1) % shardCapacity;
+}
+
+//................................................. Get the number of hits ...
+uint64_t GARFitnessCache::getHits(void) const {
+	return this->hits.load();
+}
+
+//................................................. Get the number of misses ...
+uint64_t GARFitnessCache::getMisses(void) const {
+	return this->misses.load();
+}
+
+//................................................. Reset the counters ...
+void GARFitnessCache::resetCounters(void) {
+	this->hits = 0;
+	this->misses = 0;
+}
+
+} /* namespace gar */
@@ -11,6 +11,8 @@
 #include <ga/GASStateGA.h>
 #include <ga/GAIncGA.h>
 #include <ga/GADemeGA.h>
+#include <GARIslandGA.hpp>
+#include <GARAsyncGA.hpp>
 
 using common::StringUtilities;
 
@@ -24,20 +26,28 @@ GAGeneticAlgorithm* GARGaFactory::createGeneticAlgorithm(const std::string& gaTy
 	try {
 		if (StringUtilities::trim(gaType) == "Simple") {
 			GASimpleGA::registerDefaultParameters(params);
-			return new GASimpleGA(*pGenome);
+			return new GARCheckpointableGA<GASimpleGA>(*pGenome);
 		}
 		if (StringUtilities::trim(gaType) == "SteadyState") {
 			GASteadyStateGA::registerDefaultParameters(params);
-			return new GASteadyStateGA(*pGenome);
+			return new GARCheckpointableGA<GASteadyStateGA>(*pGenome);
 		}
 		if (StringUtilities::trim(gaType) == "Incremental") {
 			GAIncrementalGA::registerDefaultParameters(params);
-			return new GAIncrementalGA(*pGenome);
+			return new GARCheckpointableGA<GAIncrementalGA>(*pGenome);
 		}
 		if (StringUtilities::trim(gaType) == "Deme") {
 			GADemeGA::registerDefaultParameters(params);
 			return new GADemeGA(*pGenome);
 		}
+		if (StringUtilities::trim(gaType) == "Island") {
+			GARIslandGA::registerDefaultParameters(params);
+			return new GARIslandGA(*pGenome);
+		}
+		if (StringUtilities::trim(gaType) == "AsyncSteadyState") {
+			GARAsyncGA::registerDefaultParameters(params);
+			return new GARAsyncGA(*pGenome);
+		}
 	} catch (const std::exception& ex) {
 		logger->fatal("Fail to create genetic algorithm for type [" + gaType + "]");
 	}
@@ -0,0 +1,326 @@
+/*
+ * GARIslandGA.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARIslandGA.hpp>
+#include <ga/garandom.h>
+#include <algorithm>
+#include <exception>
+
+using std::vector;
+using std::unique_ptr;
+using common::ThreadPool;
+
+namespace gar {
+
+//................................................. Static class attributes ...
+thread_local std::unique_lock<std::mutex>* GARIslandGA::pBreedLock (nullptr);
+thread_local GARIslandGA* GARIslandGA::pSteppingGA (nullptr);
+thread_local size_t GARIslandGA::steppingIsland (0);
+
+
+//................................................. Register the default parameters ...
+GAParameterList& GARIslandGA::registerDefaultParameters(GAParameterList& params) {
+	return GASimpleGA::registerDefaultParameters(params);
+}
+
+
+//................................................. Parameterized constructor ...
+GARIslandGA::GARIslandGA(const GAGenome& genome)
+: GAGeneticAlgorithm (genome),
+  breedTurn          (0),
+  popEvaluator       (nullptr),
+  pPool              (nullptr),
+  numIslands         (4),
+  islandSize         (pop->size()),
+  interval           (10),
+  numMigrants        (5),
+  migrationTopology  (RING),
+  threads            (4) {
+	// Intentionally left empty
+}
+
+
+//................................................. Initialize the islands ...
+void GARIslandGA::initialize(unsigned int seed) {
+	GARandomSeed(seed);
+
+	// Every island evolves a population of the configured size, evaluated by the master
+	// population evaluator, since the master population grows as it gathers the islands
+	popEvaluator = pop->evaluator();
+	GAPopulation islandPop(*pop);
+	islandPop.size(islandSize);
+	islandPop.evaluator(GARIslandGA::evaluate);
+
+	islands.clear();
+	for (int i = 0; i < numIslands; i++) {
+		GASimpleGA* pIsland = new GASimpleGA(islandPop);
+		pIsland->parameters(parameters());
+		pIsland->crossover(sexual());
+		pIsland->minimaxi(minimaxi());
+		pIsland->flushFrequency(0);
+		islands.push_back(unique_ptr<GASimpleGA>(pIsland));
+	}
+
+	unsigned int numThreads = std::min<unsigned int>(threads, islands.size());
+	pPool.reset(numThreads > 1 ? new ThreadPool(numThreads) : nullptr);
+
+	// GARandomSeed does not reseed with the seed already in use
+	forEachIsland([seed] (GASimpleGA& island) {
+		island.initialize(seed);
+	});
+
+	gather();
+	stats.reset(*pop);
+}
+
+
+//................................................. Evolve a generation ...
+void GARIslandGA::step() {
+	forEachIsland([] (GASimpleGA& island) {
+		island.step();
+	});
+
+	if (interval > 0 && (stats.generation() + 1) % interval == 0) {
+		migrate();
+	}
+
+	gather();
+	stats.update(*pop);
+}
+
+
+//................................................. Run a task on every island ...
+void GARIslandGA::forEachIsland(const std::function<void(GASimpleGA&)>& task) {
+	if (pPool == nullptr) {
+		pSteppingGA = this;
+		try {
+			for (size_t i = 0; i < islands.size(); i++) {
+				task(*islands[i]);
+			}
+		} catch (...) {
+			pSteppingGA = nullptr;
+			throw;
+		}
+		pSteppingGA = nullptr;
+		return;
+	}
+
+	auto run = [this, &task] (size_t i) {
+		std::unique_lock<std::mutex> lock(breedMtx, std::defer_lock);
+		takeTurn(i, lock);
+		pBreedLock = &lock;
+		pSteppingGA = this;
+		steppingIsland = i;
+
+		std::exception_ptr error;
+		try {
+			task(*islands[i]);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		pBreedLock = nullptr;
+		pSteppingGA = nullptr;
+
+		// The island leaves the turns
+		running[i] = false;
+		passTurn(i, lock);
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	};
+
+	// Every island of a batch runs on a thread of its own, so the turns never wait for an island
+	// not started yet. The batches run in index order, and so do the turns within a batch
+	size_t batchSize = pPool->size();
+	for (size_t first = 0; first < islands.size(); first += batchSize) {
+		size_t count = std::min(batchSize, islands.size() - first);
+		running.assign(islands.size(), false);
+		std::fill(running.begin() + first, running.begin() + first + count, true);
+		breedTurn = first;
+		pPool->parallelFor(count, [&run, first] (size_t k) {
+			run(first + k);
+		});
+	}
+}
+
+
+//................................................. Wait for the breeding turn of an island ...
+void GARIslandGA::takeTurn(size_t i, std::unique_lock<std::mutex>& lock) {
+	lock.lock();
+	breedCond.wait(lock, [this, i] () {
+		return breedTurn == i;
+	});
+}
+
+
+//................................................. Hand the breeding turn to the next island ...
+void GARIslandGA::passTurn(size_t i, std::unique_lock<std::mutex>& lock) {
+	size_t n = islands.size();
+	breedTurn = n;
+	for (size_t k = 1; k <= n; k++) {
+		if (running[(i + k) % n]) {
+			breedTurn = (i + k) % n;
+			break;
+		}
+	}
+	lock.unlock();
+	breedCond.notify_all();
+}
+
+
+//................................................. Migrate the best individuals ...
+void GARIslandGA::migrate(void) {
+	int n = islands.size();
+	int k = std::min(numMigrants, islandSize / 2);
+	if (n < 2 || k <= 0) {
+		return;
+	}
+
+	// The island populations are evaluated holding the breeding lock
+	std::lock_guard<std::mutex> lock(breedMtx);
+
+	// Pick the migrants of every island before any of them arrives
+	vector<vector<GAGenome*>> migrants(n);
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < k; j++) {
+			migrants[i].push_back(islands[i]->population().best(j).clone());
+		}
+	}
+
+	for (int i = 0; i < n; i++) {
+		int dest = (i + 1) % n;
+		if (migrationTopology == RANDOM) {
+			dest = GARandomInt(0, n - 2);
+			if (dest >= i) {
+				dest++;
+			}
+		}
+
+		// The migrants replace the worst individuals of the destination island
+		GAPopulation destPop(islands[dest]->population());
+		for (GAGenome* pMigrant : migrants[i]) {
+			delete destPop.replace(pMigrant, GAPopulation::WORST);
+		}
+		islands[dest]->population(destPop);
+	}
+}
+
+
+//................................................. Gather the island populations ...
+void GARIslandGA::gather(void) {
+	int size = 0;
+	for (const unique_ptr<GASimpleGA>& pIsland : islands) {
+		size += pIsland->population().size();
+	}
+	if (size == 0) {
+		return;
+	}
+
+	pop->size(size);
+
+	int k = 0;
+	for (const unique_ptr<GASimpleGA>& pIsland : islands) {
+		const GAPopulation& islandPop = pIsland->population();
+		for (int i = 0; i < islandPop.size(); i++) {
+			pop->individual(k++).copy(islandPop.individual(i));
+		}
+	}
+	pop->touch();
+}
+
+
+//................................................. The island population evaluator ...
+void GARIslandGA::evaluate(GAPopulation& pop) {
+	GAPopulation::Evaluator evaluator = GAPopulation::DefaultEvaluator;
+	if (pSteppingGA != nullptr && pSteppingGA->popEvaluator != nullptr) {
+		evaluator = pSteppingGA->popEvaluator;
+	}
+
+	// Let the other islands breed meanwhile, and take the turn back in order
+	if (pBreedLock == nullptr) {
+		evaluator(pop);
+		return;
+	}
+	pSteppingGA->passTurn(steppingIsland, *pBreedLock);
+	try {
+		evaluator(pop);
+	} catch (...) {
+		pSteppingGA->takeTurn(steppingIsland, *pBreedLock);
+		throw;
+	}
+	pSteppingGA->takeTurn(steppingIsland, *pBreedLock);
+}
+
+
+//................................................. Set the population size ...
+int GARIslandGA::populationSize(unsigned int n) {
+	this->islandSize = GAGeneticAlgorithm::populationSize(n);
+	return this->islandSize;
+}
+
+
+//................................................. Get the number of islands ...
+int GARIslandGA::nIslands(void) const {
+	return this->numIslands;
+}
+
+//................................................. Set the number of islands ...
+int GARIslandGA::nIslands(int n) {
+	this->numIslands = std::max(n, 1);
+	return this->numIslands;
+}
+
+//................................................. Get the migration interval ...
+int GARIslandGA::migrationInterval(void) const {
+	return this->interval;
+}
+
+//................................................. Set the migration interval ...
+int GARIslandGA::migrationInterval(int n) {
+	this->interval = std::max(n, 0);
+	return this->interval;
+}
+
+//................................................. Get the number of migrants ...
+int GARIslandGA::migrationNumber(void) const {
+	return this->numMigrants;
+}
+
+//................................................. Set the number of migrants ...
+int GARIslandGA::migrationNumber(int n) {
+	this->numMigrants = std::max(n, 0);
+	return this->numMigrants;
+}
+
+//................................................. Get the migration topology ...
+GARIslandGA::Topology GARIslandGA::topology(void) const {
+	return this->migrationTopology;
+}
+
+//................................................. Set the migration topology ...
+GARIslandGA::Topology GARIslandGA::topology(Topology t) {
+	this->migrationTopology = t;
+	return this->migrationTopology;
+}
+
+//................................................. Get the number of threads ...
+unsigned int GARIslandGA::numThreads(void) const {
+	return this->threads;
+}
+
+//................................................. Set the number of threads ...
+unsigned int GARIslandGA::numThreads(unsigned int n) {
+	this->threads = std::max(n, 1u);
+	return this->threads;
+}
+
+//................................................. Get the population of an island ...
+const GAPopulation& GARIslandGA::island(int i) const {
+	return islands.at(i)->population();
+}
+
+} /* namespace gar */
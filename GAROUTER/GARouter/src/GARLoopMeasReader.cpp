@@ -0,0 +1,261 @@
+/*
+ * GARLoopMeasReader.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARLoopMeasReader.hpp>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+using std::string;
+using std::vector;
+using std::shared_ptr;
+using std::unordered_map;
+
+namespace gar {
+
+//................................................. Parameterized constructor ...
+GARLoopMeasReader::GARLoopMeasReader(const gar::loop2det_map& loops2Dets,
+									 const SUMOTime& begin,
+									 const SUMOTime& end,
+									 const SUMOTime& timeStep)
+: loopSlots   (unordered_map<string, uint32_t>()),
+  detectorIds (vector<string>()),
+  begin       (begin),
+  end         (end),
+  timeStep    (timeStep),
+  numSteps    ((end + timeStep - begin) / timeStep) {
+	// The induction loops on the same detector share its slot
+	unordered_map<string, uint32_t> detectorSlots;
+	for (const auto& entry : loops2Dets) {
+		const string& detectorId = entry.second->getID();
+		auto slot = detectorSlots.insert(std::make_pair(detectorId, uint32_t(detectorIds.size()))).first;
+		if (slot->second == detectorIds.size()) {
+			detectorIds.push_back(detectorId);
+		}
+		loopSlots.insert(std::make_pair(entry.first, slot->second));
+	}
+}
+
+
+//................................................. Read the measurement file ...
+shared_ptr<GARDetectorFlows> GARLoopMeasReader::read(const string& measFile) const {
+	std::ifstream in(measFile);
+	if (!in.is_open()) {
+		std::cerr << "Fail to open induction loop measurement file '" << measFile << "'" << std::endl;
+		return nullptr;
+	}
+
+	return read(in, measFile);
+}
+
+
+//................................................. Read the measurement stream ...
+shared_ptr<GARDetectorFlows> GARLoopMeasReader::read(std::istream& in, const string& source) const {
+	shared_ptr<GARDetectorFlows> pDetFlows = std::make_shared<GARDetectorFlows>(begin, end, timeStep);
+	if (read(in, source, *pDetFlows) > 0) {
+		return nullptr;
+	}
+
+	return pDetFlows;
+}
+
+
+//................................................. Read the measurement file into the detector flows ...
+int GARLoopMeasReader::read(const string& measFile, GARDetectorFlows& detFlows) const {
+	std::ifstream in(measFile);
+	if (!in.is_open()) {
+		std::cerr << "Fail to open induction loop measurement file '" << measFile << "'" << std::endl;
+		return 1;
+	}
+
+	return read(in, measFile, detFlows);
+}
+
+
+//................................................. Read the measurement stream into the detector flows ...
+int GARLoopMeasReader::read(std::istream& in, const string& source, GARDetectorFlows& detFlows) const {
+	// The flows of every detector slot, added to the detector flows on its first measurement
+	vector<vector<FlowDef>*> slotFlows(detectorIds.size(), nullptr);
+
+	string chunk;
+	string id, sBegin, sVeh, sSpeed;
+	while (std::getline(in, chunk, '>')) {
+		size_t start = chunk.find('<');
+		if (start == string::npos) {
+			continue;
+		}
+
+		// Skip the comments, which may hold the '>' character
+		if (chunk.compare(start, 4, "<!--") == 0) {
+			bool closed = chunk.size() >= start + 6 && chunk.compare(chunk.size() - 2, 2, "--") == 0;
+			while (!closed && std::getline(in, chunk, '>')) {
+				closed = chunk.size() >= 2 && chunk.compare(chunk.size() - 2, 2, "--") == 0;
+			}
+			continue;
+		}
+
+		// Only the interval elements hold measurements
+		if (chunk.compare(start, 9, "<interval") != 0 || !std::isspace(chunk[start + 9])) {
+			continue;
+		}
+
+		if (!getAttribute(chunk, "id", id)) {
+			continue;
+		}
+
+		// Get the detector slot of the induction loop
+		auto it = loopSlots.find(id);
+		if (it == loopSlots.end()) {
+			std::cerr << "Can't find detector for induction loop [" << id << "]" << std::endl;
+			continue;
+		}
+
+		if (!getAttribute(chunk, "begin", sBegin)) {
+			sBegin.clear();
+		}
+		if (!getAttribute(chunk, "nVehContrib", sVeh)) {
+			sVeh = "0";
+		}
+		if (!getAttribute(chunk, "speed", sSpeed)) {
+			sSpeed = "-1.00";
+		}
+
+		// Parse the measurement attributes
+		char* endPtr = nullptr;
+		SUMOTime time = (int)std::strtod(sBegin.c_str(), &endPtr);
+		bool valid = !sBegin.empty() && *endPtr == '\0';
+		int nVehContrib = std::strtol(sVeh.c_str(), &endPtr, 10);
+		valid = valid && !sVeh.empty() && *endPtr == '\0';
+		float speed = std::strtod(sSpeed.c_str(), &endPtr);
+		valid = valid && !sSpeed.empty() && *endPtr == '\0';
+
+		if (!valid) {
+			std::cerr << "Fail to read induction loop measurements from file '" << source
+					  << "': bad interval of induction loop [" << id << "]" << std::endl;
+			return 1;
+		}
+
+		// Discard measurements out of the simulation time
+		if (time < begin || time > end) {
+			continue;
+		}
+		uint32_t step = (time - begin) / timeStep;
+		if (step >= numSteps) {
+			continue;
+		}
+
+		// Add the measurement as the detector flows do when several loops share a detector
+		vector<FlowDef>*& pFlows = slotFlows[it->second];
+		if (pFlows == nullptr) {
+			pFlows = &detFlows.getOrAddFlowDefs(detectorIds[it->second]);
+		}
+		if (step >= pFlows->size()) {
+			continue;
+		}
+		FlowDef& fd = (*pFlows)[step];
+		if (fd.firstSet) {
+			fd.qPKW = nVehContrib;
+			fd.vPKW = speed;
+			fd.firstSet = false;
+		} else {
+			fd.qPKW += nVehContrib;
+			fd.vPKW += speed;
+		}
+	}
+
+	if (in.bad()) {
+		std::cerr << "Fail to read induction loop measurements from file '" << source << "'" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+
+//................................................. Get an attribute value ...
+bool GARLoopMeasReader::getAttribute(const string& tag, const char* name, string& value) {
+	const size_t length = std::strlen(name);
+
+	for (size_t pos = tag.find(name); pos != string::npos; pos = tag.find(name, pos + 1)) {
+		// The attribute name is preceded by a blank and followed by the equals sign
+		size_t eq = pos + length;
+		if (pos == 0 || !std::isspace(tag[pos - 1]) || eq >= tag.size() || tag[eq] != '=') {
+			continue;
+		}
+
+		size_t quote = eq + 1;
+		if (quote >= tag.size() || (tag[quote] != '"' && tag[quote] != '\'')) {
+			return false;
+		}
+
+		size_t close = tag.find(tag[quote], quote + 1);
+		if (close == string::npos) {
+			return false;
+		}
+
+		value.assign(tag, quote + 1, close - quote - 1);
+		if (value.find('&') != string::npos) {
+			decodeEntities(value);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+
+//................................................. Decode the XML entities ...
+void GARLoopMeasReader::decodeEntities(string& text) {
+	static const struct { const char* entity; char character; } ENTITIES[] = {
+		{ "&amp;", '&' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&quot;", '"' }, { "&apos;", '\'' }
+	};
+
+	size_t dst = 0;
+	for (size_t src = 0; src < text.size(); ) {
+		if (text[src] != '&') {
+			text[dst++] = text[src++];
+			continue;
+		}
+
+		size_t semicolon = text.find(';', src);
+		bool decoded = false;
+		if (semicolon != string::npos) {
+			// The predefined entities
+			for (const auto& e : ENTITIES) {
+				size_t length = std::strlen(e.entity);
+				if (semicolon + 1 - src == length && text.compare(src, length, e.entity) == 0) {
+					text[dst++] = e.character;
+					decoded = true;
+					break;
+				}
+			}
+
+			// The numeric character references in the ASCII range
+			if (!decoded && src + 2 < semicolon && text[src + 1] == '#') {
+				bool hex = (text[src + 2] == 'x' || text[src + 2] == 'X');
+				string digits = text.substr(src + (hex ? 3 : 2), semicolon - src - (hex ? 3 : 2));
+				char* endPtr = nullptr;
+				long code = std::strtol(digits.c_str(), &endPtr, hex ? 16 : 10);
+				if (!digits.empty() && std::isxdigit((unsigned char)digits[0]) && *endPtr == '\0' && code > 0 && code < 128) {
+					text[dst++] = (char)code;
+					decoded = true;
+				}
+			}
+		}
+
+		if (decoded) {
+			src = semicolon + 1;
+		} else {
+			text[dst++] = text[src++];
+		}
+	}
+	text.resize(dst);
+}
+
+} /* namespace gar */
@@ -0,0 +1,138 @@
+/*
+ * GARPopulationEvaluator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARPopulationEvaluator.hpp>
+#include <limits>
+
+using std::unique_ptr;
+using std::vector;
+using std::mutex;
+using std::lock_guard;
+using common::ThreadPool;
+
+namespace gar {
+
+//................................................. Static class attributes ...
+unique_ptr<ThreadPool> GARPopulationEvaluator::pPool;
+const GARBudgetTerminator* GARPopulationEvaluator::pTerminator (nullptr);
+mutex GARPopulationEvaluator::scoreMtx;
+bool GARPopulationEvaluator::anyScored (false);
+bool GARPopulationEvaluator::lastScored (true);
+bool GARPopulationEvaluator::noneScored (false);
+float GARPopulationEvaluator::lastWorst (0.0);
+
+
+//................................................. The population evaluator ...
+void GARPopulationEvaluator::evaluate(GAPopulation& pop) {
+	// Leave the individuals alone once the deadline is reached
+	vector<char> skipped(pop.size(), 0);
+	auto evaluateIndividual = [&pop, &skipped] (size_t i) {
+		if (pTerminator != nullptr && pTerminator->expired()) {
+			skipped[i] = 1;
+			return;
+		}
+		pop.individual(i).evaluate();
+	};
+
+	// Evaluate serially if there is no thread pool
+	if (pPool == nullptr || pPool->size() <= 1) {
+		for (int i = 0; i < pop.size(); i++) {
+			evaluateIndividual(i);
+		}
+	} else {
+		pPool->parallelFor(pop.size(), evaluateIndividual);
+	}
+
+	scoreSkipped(pop, skipped);
+}
+
+
+//................................................. Score the individuals left at the deadline ...
+void GARPopulationEvaluator::scoreSkipped(GAPopulation& pop, const vector<char>& skipped) {
+	bool lowIsBest = (pop.order() == GAPopulation::LOW_IS_BEST);
+	bool found = false;
+	float worst = 0.0;
+	for (int i = 0; i < pop.size(); i++) {
+		if (skipped[i]) {
+			continue;
+		}
+		float score = pop.individual(i).score();
+		if (!found || (lowIsBest ? score > worst : score < worst)) {
+			worst = score;
+			found = true;
+		}
+	}
+
+	// The islands evaluate their populations concurrently
+	lock_guard<mutex> lock(scoreMtx);
+	lastScored = found;
+	noneScored = !found && !anyScored;
+	if (found) {
+		// Keep the worst score of the population for the populations left unevaluated later
+		if (!anyScored || (lowIsBest ? worst > lastWorst : worst < lastWorst)) {
+			lastWorst = worst;
+		}
+		anyScored = true;
+	} else if (anyScored) {
+		// No individual was evaluated: the worst score of the previous populations
+		worst = lastWorst;
+	} else {
+		// Nor in any previous population: the worst score there is
+		worst = lowIsBest ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+	}
+
+	for (int i = 0; i < pop.size(); i++) {
+		if (skipped[i]) {
+			pop.individual(i).score(worst);
+		}
+	}
+}
+
+
+//................................................. Check whether the last population was evaluated ...
+bool GARPopulationEvaluator::isLastScored(void) {
+	lock_guard<mutex> lock(scoreMtx);
+	return lastScored;
+}
+
+
+//................................................. Check whether any population was evaluated ...
+bool GARPopulationEvaluator::isAnyScored(void) {
+	lock_guard<mutex> lock(scoreMtx);
+	return !noneScored;
+}
+
+
+//................................................. Set the number of evaluation threads ...
+void GARPopulationEvaluator::setNumThreads(unsigned int numThreads) {
+	if (pPool != nullptr && pPool->size() == numThreads) {
+		return;
+	}
+
+	pPool.reset(numThreads > 1 ? new ThreadPool(numThreads) : nullptr);
+}
+
+
+//................................................. Get the number of evaluation threads ...
+unsigned int GARPopulationEvaluator::getNumThreads(void) {
+	return (pPool != nullptr) ? pPool->size() : 1;
+}
+
+
+//................................................. Set the budget terminator ...
+void GARPopulationEvaluator::setTerminator(const GARBudgetTerminator* pTerminator) {
+	GARPopulationEvaluator::pTerminator = pTerminator;
+
+	// A new evolution starts
+	lock_guard<mutex> lock(scoreMtx);
+	anyScored = false;
+	lastScored = true;
+	noneScored = false;
+	lastWorst = 0.0;
+}
+
+} /* namespace gar */
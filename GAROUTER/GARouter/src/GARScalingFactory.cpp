@@ -6,8 +6,11 @@
  */
 
 #include <GARScalingFactory.hpp>
+#include <GARStaticObjData.hpp>
+#include <GARCountGenome.hpp>
 #include <StringUtilities.hpp>
 #include <cstdlib>
+#include <algorithm>
 
 using common::StringUtilities;
 using std::string;
@@ -116,6 +119,14 @@ float GARScalingFactory::GARAlleleDistance(const GAGenome& g1, const GAGenome& g
 		return computeStaticDistance((const genome_static&)g1, (const genome_static&)g2);
 	}
 
+	if (typeid(g1) == typeid(genome_static_wide)  &&  typeid(g2) == typeid(genome_static_wide)) {
+		return computeStaticDistance((const genome_static_wide&)g1, (const genome_static_wide&)g2);
+	}
+
+	if (typeid(g1) == typeid(GARCountGenome)  &&  typeid(g2) == typeid(GARCountGenome)) {
+		return GARCountGenome::Comparator(g1, g2);
+	}
+
 	if (typeid(g1) == typeid(genome_dyn)  &&  typeid(g2) == typeid(genome_dyn)) {
 		return computeDynamicDistance((const genome_dyn&)g1, (const genome_dyn&)g2);
 	}
@@ -125,25 +136,33 @@ float GARScalingFactory::GARAlleleDistance(const GAGenome& g1, const GAGenome& g
 
 
 //................................................. The sharing distance for the static approach ...
-float GARScalingFactory::computeStaticDistance(const genome_static& genome1, const genome_static& genome2) {
-	vector<string> genomevec2;
+template<class Genome>
+float GARScalingFactory::computeStaticDistance(const Genome& genome1, const Genome& genome2) {
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome1.userData();
+
+	// Resolve the genes of both genomes into sorted route indices
+	vector<int> routes1(genome1.size());
+	for (int i = 0; i < genome1.size(); i++) {
+		routes1[i] = pData->getGeneRoute(i, genome1.gene(i));
+	}
+	vector<int> routes2(genome2.size());
 	for (int i = 0; i < genome2.size(); i++) {
-		genomevec2.push_back(string(genome2.gene(i)));
+		routes2[i] = pData->getGeneRoute(i, genome2.gene(i));
 	}
+	std::sort(routes1.begin(), routes1.end());
+	std::sort(routes2.begin(), routes2.end());
 
+	// Every route of genome1 not matched by a route of genome2 adds to the distance
 	float dist = 0.0;
-
-	// Compare the genomes gene-to-gene
-	for (int i = 0; i < genome1.size(); i++) {
-		// Get the gene in genome2
-		string gene = genome1.gene(i);
-
-		// Find the gene in genome2
-		auto it = std::find(genomevec2.begin(), genomevec2.end(), gene);
-		if (it == genomevec2.end()) {
-			dist += 1;
+	size_t j = 0;
+	for (size_t i = 0; i < routes1.size(); i++) {
+		while (j < routes2.size() && routes2[j] < routes1[i]) {
+			j++;
+		}
+		if (j < routes2.size() && routes2[j] == routes1[i]) {
+			j++;
 		} else {
-			genomevec2.erase(it);
+			dist += 1;
 		}
 	}
 
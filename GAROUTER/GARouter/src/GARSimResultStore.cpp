@@ -0,0 +1,363 @@
+/*
+ * GARSimResultStore.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARSimResultStore.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+using std::string;
+using std::vector;
+using std::shared_ptr;
+using common::HashUtilities;
+
+namespace gar {
+
+//................................................. Class constants ...
+const char GARSimResultStore::MAGIC[8] = { 'G', 'A', 'R', 'S', 'I', 'M', 'S', 'T' };
+const uint32_t GARSimResultStore::VERSION (1);
+
+//! The size of the store file header: the magic bytes, the version and a reserved word
+static const uint64_t GAR_STORE_HEADER_SIZE (sizeof(GARSimResultStore::MAGIC) + 2 * sizeof(uint32_t));
+
+
+//................................................. Write a whole buffer to a file ...
+static int writeAll(int fd, const char* data, size_t len) {
+	while (len > 0) {
+		ssize_t n = ::write(fd, data, len);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return 1;
+		}
+		data += n;
+		len -= n;
+	}
+	return 0;
+}
+
+
+//................................................. Parameterized constructor ...
+GARSimResultStore::GARSimResultStore(CLogger* logger)
+: logger      (logger),
+  fd          (-1),
+  pMap        (nullptr),
+  mapSize     (0),
+  fileSize    (0),
+  fingerprint ({0, 0}),
+  begin       (0),
+  end         (0),
+  timeStep    (0),
+  hits        (0),
+  misses      (0) {
+	// Intentionally left empty
+}
+
+//................................................. Destructor ...
+GARSimResultStore::~GARSimResultStore() {
+	unmap();
+	if (fd >= 0) {
+		::close(fd);
+	}
+}
+
+
+//................................................. Open the store file ...
+int GARSimResultStore::open(const string& path,
+							const Hash128& fingerprint,
+							const vector<string>& detectorIds,
+							const SUMOTime& begin,
+							const SUMOTime& end,
+							const SUMOTime& timeStep) {
+	std::lock_guard<std::mutex> lock(mtx);
+
+	this->fingerprint = fingerprint;
+	this->detectorIds = detectorIds;
+	this->begin = begin;
+	this->end = end;
+	this->timeStep = timeStep;
+
+	fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+	if (fd < 0) {
+		logger->error("Unable to open the simulation result store [" + path + "]: " + std::strerror(errno));
+		return 1;
+	}
+
+	// Hold the file while its header is checked and its tail repaired
+	::flock(fd, LOCK_EX);
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0) {
+		::flock(fd, LOCK_UN);
+		logger->error("Unable to stat the simulation result store [" + path + "]");
+		return 1;
+	}
+	fileSize = st.st_size;
+
+	// Write the header of a new store
+	if (fileSize < GAR_STORE_HEADER_SIZE) {
+		char header[GAR_STORE_HEADER_SIZE];
+		uint32_t words[2] = { VERSION, 0 };
+		std::memcpy(header, MAGIC, sizeof(MAGIC));
+		std::memcpy(header + sizeof(MAGIC), words, sizeof(words));
+
+		if (::ftruncate(fd, 0) != 0 || writeAll(fd, header, sizeof(header)) > 0) {
+			::flock(fd, LOCK_UN);
+			logger->error("Unable to write the simulation result store [" + path + "]");
+			return 1;
+		}
+		fileSize = GAR_STORE_HEADER_SIZE;
+	}
+
+	if (remap() > 0) {
+		::flock(fd, LOCK_UN);
+		return 1;
+	}
+
+	// Refuse a file that is not a store, so it is never overwritten
+	uint32_t version = 0;
+	std::memcpy(&version, pMap + sizeof(MAGIC), sizeof(version));
+	if (std::memcmp(pMap, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION) {
+		::flock(fd, LOCK_UN);
+		logger->error("The file [" + path + "] is not a simulation result store of version " + std::to_string(VERSION));
+		return 1;
+	}
+
+	int status = scan(GAR_STORE_HEADER_SIZE);
+	::flock(fd, LOCK_UN);
+
+	return status;
+}
+
+
+//................................................. Index the records of the store file ...
+int GARSimResultStore::scan(uint64_t from) {
+	uint64_t pos = from;
+
+	while (pos + sizeof(RecordHeader) <= fileSize) {
+		RecordHeader header;
+		std::memcpy(&header, pMap + pos, sizeof(header));
+
+		uint64_t length = sizeof(RecordHeader) + uint64_t(header.numDetectors) * header.numSteps * sizeof(double);
+		if (pos + length > fileSize) {
+			break;
+		}
+
+		Hash128 key;
+		key.lo = header.keyLo;
+		key.hi = header.keyHi;
+		index[key] = pos;
+
+		pos += length;
+	}
+
+	// Drop the torn record written by an interrupted run
+	if (pos < fileSize) {
+		logger->warning("Truncating a torn record at the end of the simulation result store");
+		if (::ftruncate(fd, pos) != 0) {
+			logger->error("Unable to truncate the simulation result store");
+			return 1;
+		}
+		fileSize = pos;
+	}
+
+	return 0;
+}
+
+
+//................................................. Map the store file ...
+int GARSimResultStore::remap(void) {
+	unmap();
+
+	void* p = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED) {
+		logger->error(string("Unable to map the simulation result store: ") + std::strerror(errno));
+		return 1;
+	}
+
+	pMap = (char*)p;
+	mapSize = fileSize;
+
+	return 0;
+}
+
+//................................................. Unmap the store file ...
+void GARSimResultStore::unmap(void) {
+	if (pMap != nullptr) {
+		::munmap(pMap, mapSize);
+		pMap = nullptr;
+		mapSize = 0;
+	}
+}
+
+
+//................................................. Look up the flows of a genome ...
+shared_ptr<GARDetectorFlows> GARSimResultStore::find(const Hash128& genomeKey) {
+	Hash128 key = HashUtilities::combine(fingerprint, genomeKey);
+	vector<double> counts;
+	RecordHeader header;
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+
+		auto it = index.find(key);
+		if (it == index.end() || pMap == nullptr) {
+			misses++;
+			return nullptr;
+		}
+
+		// Extend the mapping over the records appended since it was built
+		if (mapSize < fileSize && remap() > 0) {
+			misses++;
+			return nullptr;
+		}
+
+		std::memcpy(&header, pMap + it->second, sizeof(header));
+		if (header.numDetectors != detectorIds.size()) {
+			misses++;
+			return nullptr;
+		}
+
+		counts.resize(size_t(header.numDetectors) * header.numSteps);
+		std::memcpy(counts.data(), pMap + it->second + sizeof(header), counts.size() * sizeof(double));
+	}
+
+	// Rebuild the detector flows from the stored counts
+	shared_ptr<GARDetectorFlows> pFlows = std::make_shared<GARDetectorFlows>(begin, end, timeStep);
+	for (uint32_t d = 0; d < header.numDetectors; d++) {
+		vector<FlowDef> flows;
+		flows.reserve(header.numSteps);
+
+		for (uint32_t s = 0; s < header.numSteps; s++) {
+			double count = counts[size_t(d) * header.numSteps + s];
+			if (std::isnan(count)) {
+				break;
+			}
+
+			FlowDef flow;
+			flow.qPKW  = count;
+			flow.vPKW  = -1.;
+			flow.qLKW  = 0.0;
+			flow.vLKW  = 0.0;
+			flow.isLKW = 0.0;
+			flow.fLKW  = 0.0;
+			flow.firstSet = false;
+			flows.push_back(flow);
+		}
+
+		if (!flows.empty()) {
+			pFlows->setFlows(detectorIds[d], flows);
+		}
+	}
+
+	hits++;
+	return pFlows;
+}
+
+
+//................................................. Append the flows of a genome ...
+int GARSimResultStore::insert(const Hash128& genomeKey, const GARDetectorFlows& flows) {
+	Hash128 key = HashUtilities::combine(fingerprint, genomeKey);
+
+	// Lay out the counts of every detector, padding the missing intervals with NaN
+	uint32_t numSteps = 0;
+	for (const string& id : detectorIds) {
+		if (flows.knows(id)) {
+			numSteps = std::max<uint32_t>(numSteps, flows.getFlowDefs(id).size());
+		}
+	}
+
+	RecordHeader header;
+	header.keyLo = key.lo;
+	header.keyHi = key.hi;
+	header.numDetectors = detectorIds.size();
+	header.numSteps = numSteps;
+
+	vector<char> record(sizeof(header) + size_t(header.numDetectors) * numSteps * sizeof(double));
+	std::memcpy(record.data(), &header, sizeof(header));
+
+	double* counts = (double*)(record.data() + sizeof(header));
+	std::fill(counts, counts + size_t(header.numDetectors) * numSteps, std::numeric_limits<double>::quiet_NaN());
+	for (uint32_t d = 0; d < header.numDetectors; d++) {
+		if (!flows.knows(detectorIds[d])) {
+			continue;
+		}
+		const vector<FlowDef>& fds = flows.getFlowDefs(detectorIds[d]);
+		for (uint32_t s = 0; s < fds.size(); s++) {
+			counts[size_t(d) * numSteps + s] = fds[s].qPKW;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(mtx);
+	if (fd < 0 || index.count(key) > 0) {
+		return 0;
+	}
+
+	// Serialize the appends of concurrent runs sharing the store
+	::flock(fd, LOCK_EX);
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0) {
+		::flock(fd, LOCK_UN);
+		return 1;
+	}
+
+	// Index the records appended by other runs meanwhile
+	if (uint64_t(st.st_size) > fileSize) {
+		uint64_t from = fileSize;
+		fileSize = st.st_size;
+		if (remap() > 0 || scan(from) > 0) {
+			::flock(fd, LOCK_UN);
+			return 1;
+		}
+		if (index.count(key) > 0) {
+			::flock(fd, LOCK_UN);
+			return 0;
+		}
+	}
+
+	uint64_t offset = fileSize;
+	int status = writeAll(fd, record.data(), record.size());
+	::flock(fd, LOCK_UN);
+
+	if (status > 0) {
+		logger->error(string("Unable to append to the simulation result store: ") + std::strerror(errno));
+		return 1;
+	}
+
+	index[key] = offset;
+	fileSize = offset + record.size();
+
+	return 0;
+}
+
+
+//................................................. Get the number of records ...
+size_t GARSimResultStore::size(void) {
+	std::lock_guard<std::mutex> lock(mtx);
+	return this->index.size();
+}
+
+//................................................. Get the number of hits ...
+uint64_t GARSimResultStore::getHits(void) const {
+	return this->hits.load();
+}
+
+//................................................. Get the number of misses ...
+uint64_t GARSimResultStore::getMisses(void) const {
+	return this->misses.load();
+}
+
+} /* namespace gar */
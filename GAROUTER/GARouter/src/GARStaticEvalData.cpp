@@ -0,0 +1,90 @@
+/*
+ * GARStaticEvalData.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARStaticEvalData.hpp>
+
+using std::vector;
+
+namespace gar {
+
+//................................................. Empty constructor ...
+GARStaticEvalData::GARStaticEvalData()
+: GAEvalData (),
+  genes      (vector<uint32_t>()),
+  residuals  (vector<int32_t>()),
+  sqErrorSum (0),
+  valid      (false),
+  changed    (vector<int>()),
+  tracked    (false) {
+	// Intentionally left empty
+}
+
+//................................................. Copy constructor ...
+GARStaticEvalData::GARStaticEvalData(const GARStaticEvalData& other)
+: GAEvalData (other),
+  genes      (other.genes),
+  residuals  (other.residuals),
+  sqErrorSum (other.sqErrorSum),
+  valid      (other.valid),
+  changed    (other.changed),
+  tracked    (other.tracked) {
+	// Intentionally left empty
+}
+
+//................................................. Clone the evaluation data ...
+GAEvalData* GARStaticEvalData::clone() const {
+	return new GARStaticEvalData(*this);
+}
+
+//................................................. Copy the evaluation data ...
+void GARStaticEvalData::copy(const GAEvalData& orig) {
+	if (&orig == this) {
+		return;
+	}
+
+	const GARStaticEvalData& other = dynamic_cast<const GARStaticEvalData&>(orig);
+	this->genes      = other.genes;
+	this->residuals  = other.residuals;
+	this->sqErrorSum = other.sqErrorSum;
+	this->valid      = other.valid;
+	this->changed    = other.changed;
+	this->tracked    = other.tracked;
+}
+
+//................................................. Check whether the evaluation state is set ...
+bool GARStaticEvalData::isValid(void) const {
+	return this->valid;
+}
+
+//................................................. Invalidate the evaluation state ...
+void GARStaticEvalData::invalidate(void) {
+	this->valid = false;
+	this->tracked = false;
+	this->changed.clear();
+}
+
+//................................................. Record a changed gene ...
+void GARStaticEvalData::recordChange(int gene) {
+	if (!this->tracked) {
+		return;
+	}
+	if (this->changed.size() * 2 >= this->genes.size()) {
+		this->tracked = false;
+		this->changed.clear();
+		return;
+	}
+	this->changed.push_back(gene);
+}
+
+//................................................. Mark the evaluation state as updated ...
+void GARStaticEvalData::commit(void) {
+	this->valid = true;
+	this->tracked = true;
+	this->changed.clear();
+}
+
+} /* namespace gar */
@@ -6,19 +6,40 @@
  */
 
 #include "GARStaticObjData.hpp"
+#include <router/ROEdge.h>
+#include <StringUtilities.hpp>
+#include <algorithm>
 
 using std::string;
 using std::vector;
+using std::unordered_map;
+using common::StringUtilities;
 
 namespace gar {
 
 //................................................. Parameterized constructor ...
 GARStaticObjData::GARStaticObjData(CLogger* logger)
-: pNet 	   (nullptr),
-  pRouCont (nullptr),
-  pDetCont (nullptr),
-  pDetFlows(nullptr),
-  logger   (logger) {
+: pNet               (nullptr),
+  pRouCont           (nullptr),
+  pDetCont           (nullptr),
+  pDetFlows          (nullptr),
+  edgeIds            (vector<string>()),
+  routeEdgeOffsets   (vector<uint32_t>()),
+  routeEdgeIndices   (vector<uint32_t>()),
+  targetEdges        (vector<uint32_t>()),
+  targetFlows        (vector<int>()),
+  routeIndices       (unordered_map<string, uint32_t>()),
+  geneOds            (vector<uint32_t>()),
+  odGeneOffsets      (vector<uint32_t>(1, 0)),
+  odRouteOffsets     (vector<uint32_t>(1, 0)),
+  odRoutes           (vector<uint32_t>()),
+  odTrips            (vector<uint32_t>()),
+  deltaEvaluation    (false),
+  crossover          (nullptr),
+  pFitnessCache      (nullptr),
+  localSearchElites  (0),
+  localSearchMoves   (0),
+  logger             (logger) {
 	// Intentionally left empty
 }
 
@@ -62,4 +83,282 @@ void GARStaticObjData::setpDetFlows(const GARDetectorFlows const* pDetFlows) {
 	this->pDetFlows = pDetFlows;
 }
 
+//................................................. Build the route-to-edge incidence ...
+int GARStaticObjData::buildRouteEdgeIncidence(void) {
+	if (pNet == nullptr || pRouCont == nullptr) {
+		logger->error("The network and the routes must be set before building the route-edge incidence.");
+		return 1;
+	}
+
+	try {
+		edgeIds.clear();
+		routeEdgeOffsets.clear();
+		routeEdgeIndices.clear();
+		routeIndices.clear();
+
+		// Give a dense index to every non-internal edge, following the edge map order
+		unordered_map<const ROEdge*, uint32_t> edgeIndices;
+		for (auto edgePair : pNet->getEdgeMap()) {
+			const ROEdge const* pEdge = edgePair.second;
+			if (pEdge->getType() == ROEdge::EdgeType::ET_INTERNAL) {
+				continue;
+			}
+			edgeIndices[pEdge] = (uint32_t)edgeIds.size();
+			edgeIds.push_back(edgePair.first);
+		}
+
+		// Store the dense edge indices of every route in CSR layout
+		const vector<GARRouteDesc>& routes = pRouCont->get();
+		routeEdgeOffsets.reserve(routes.size() + 1);
+		routeEdgeOffsets.push_back(0);
+		for (const GARRouteDesc& rd : routes) {
+			for (const ROEdge const* pEdge : rd.edges2Pass) {
+				auto it = edgeIndices.find(pEdge);
+				if (it != edgeIndices.end()) {
+					routeEdgeIndices.push_back(it->second);
+				}
+			}
+			routeEdgeOffsets.push_back((uint32_t)routeEdgeIndices.size());
+
+			// Keep the first route found with a given name
+			routeIndices.insert(std::make_pair(rd.routename, (uint32_t)(routeEdgeOffsets.size() - 2)));
+		}
+
+	} catch (const std::exception& ex) {
+		logger->error("Fail to build the route-edge incidence: " + string(ex.what()));
+		return 1;
+	}
+
+	logger->info("Route-edge incidence built: [" + StringUtilities::toString<int>(routeIndices.size()) + "] routes, ["
+				 + StringUtilities::toString<int>(edgeIds.size()) + "] edges");
+	return 0;
+}
+
+//................................................. Clear the gene layout of the static genome ...
+void GARStaticObjData::clearGeneLayout(void) {
+	geneOds.clear();
+	odGeneOffsets.assign(1, 0);
+	odRouteOffsets.assign(1, 0);
+	odRoutes.clear();
+	odTrips.clear();
+}
+
+//................................................. Append the genes of an OD pair ...
+int GARStaticObjData::addOdGenes(const std::vector<std::string>& routeNames, int numGenes) {
+	try {
+		// Resolve the candidate route names into route indices
+		for (const string& routename : routeNames) {
+			auto it = routeIndices.find(routename);
+			if (it == routeIndices.end()) {
+				logger->error("Route [" + routename + "] is not in the route-edge incidence");
+				return 1;
+			}
+			odRoutes.push_back(it->second);
+		}
+
+		uint32_t od = (uint32_t)(odRouteOffsets.size() - 1);
+		odRouteOffsets.push_back((uint32_t)odRoutes.size());
+		odTrips.push_back((uint32_t)numGenes);
+		geneOds.insert(geneOds.end(), (size_t)numGenes, od);
+		odGeneOffsets.push_back((uint32_t)geneOds.size());
+
+	} catch (const std::exception& ex) {
+		logger->error("Fail to add the OD pair genes of the static genome: " + string(ex.what()));
+		return 1;
+	}
+
+	return 0;
+}
+
+//................................................. Build the detector flow targets per edge ...
+int GARStaticObjData::buildDetectorTargets(void) {
+	if (pDetCont == nullptr || pDetFlows == nullptr) {
+		logger->error("The detectors and the detector flows must be set before building the detector targets.");
+		return 1;
+	}
+
+	try {
+		targetEdges.clear();
+		targetFlows.clear();
+
+		for (uint32_t e = 0; e < edgeIds.size(); e++) {
+			if (pDetCont->getEdgeDetectors(edgeIds[e]).empty()) {
+				continue;
+			}
+			targetEdges.push_back(e);
+			targetFlows.push_back(computeDetFlowSumPerEdge(edgeIds[e]));
+		}
+
+	} catch (const std::exception& ex) {
+		logger->error("Fail to build the detector targets: " + string(ex.what()));
+		return 1;
+	}
+
+	logger->info("Detector targets built: [" + StringUtilities::toString<int>(targetEdges.size()) + "] edges with detectors");
+	return 0;
+}
+
+//................................................. Compute the flow amount sum of the detectors in an edge ...
+int GARStaticObjData::computeDetFlowSumPerEdge(const std::string& edgeId) const {
+	vector<GARDetector*> edgeDetectors = pDetCont->getEdgeDetectors(edgeId);
+
+	int flowSum = 0;
+
+	for (const GARDetector const* pDet : edgeDetectors) {
+		flowSum += pDetFlows->getFlowSumSecure(pDet->getID());
+	}
+
+	return flowSum;
+}
+
+//................................................. Get the number of dense edges ...
+uint32_t GARStaticObjData::getNumEdges(void) const {
+	return (uint32_t)this->edgeIds.size();
+}
+
+//................................................. Get the edge identifier of a dense edge index ...
+const std::string& GARStaticObjData::getEdgeId(uint32_t edgeIndex) const {
+	return this->edgeIds[edgeIndex];
+}
+
+//................................................. Get the number of genes ...
+int GARStaticObjData::getNumGenes(void) const {
+	return (int)this->geneOds.size();
+}
+
+//................................................. Get the number of candidate routes of a gene ...
+uint32_t GARStaticObjData::getNumGeneRoutes(int gene) const {
+	uint32_t od = geneOds[gene];
+	return odRouteOffsets[od + 1] - odRouteOffsets[od];
+}
+
+//................................................. Get the OD pair of a gene ...
+uint32_t GARStaticObjData::getGeneOd(int gene) const {
+	return geneOds[gene];
+}
+
+//................................................. Get the gene offsets of the OD pairs ...
+const std::vector<uint32_t>& GARStaticObjData::getOdGeneOffsets(void) const {
+	return this->odGeneOffsets;
+}
+
+//................................................. Get the route index of a gene value ...
+int GARStaticObjData::getGeneRoute(int gene, uint32_t allele) const {
+	uint32_t od = geneOds[gene];
+	uint32_t first = odRouteOffsets[od];
+	uint32_t count = odRouteOffsets[od + 1] - first;
+
+	if (count == 0) {
+		return -1;
+	}
+
+	// Wrap the alleles moved from the genes of other OD pairs by the permutation crossovers
+	uint32_t local = allele;
+	if (local >= count) {
+		local %= count;
+	}
+
+	return (int)odRoutes[first + local];
+}
+
+//................................................. Get the largest number of candidate routes of an OD pair ...
+uint32_t GARStaticObjData::getMaxOdRoutes(void) const {
+	uint32_t maxRoutes = 0;
+	for (size_t od = 0; od + 1 < odRouteOffsets.size(); od++) {
+		maxRoutes = std::max(maxRoutes, odRouteOffsets[od + 1] - odRouteOffsets[od]);
+	}
+	return maxRoutes;
+}
+
+//................................................. Get the number of OD pairs ...
+uint32_t GARStaticObjData::getNumOds(void) const {
+	return (uint32_t)this->odTrips.size();
+}
+
+//................................................. Get the number of trips of an OD pair ...
+uint32_t GARStaticObjData::getOdTrips(uint32_t od) const {
+	return this->odTrips[od];
+}
+
+//................................................. Get the offsets of the OD candidate routes ...
+const std::vector<uint32_t>& GARStaticObjData::getOdRouteOffsets(void) const {
+	return this->odRouteOffsets;
+}
+
+//................................................. Get the OD candidate routes ...
+const std::vector<uint32_t>& GARStaticObjData::getOdRoutes(void) const {
+	return this->odRoutes;
+}
+
+//................................................. Get the route description of a route index ...
+const GARRouteDesc& GARStaticObjData::getRouteDesc(uint32_t route) const {
+	return this->pRouCont->get()[route];
+}
+
+//................................................. Get the CSR row offsets ...
+const std::vector<uint32_t>& GARStaticObjData::getRouteEdgeOffsets(void) const {
+	return this->routeEdgeOffsets;
+}
+
+//................................................. Get the CSR edge indices ...
+const std::vector<uint32_t>& GARStaticObjData::getRouteEdgeIndices(void) const {
+	return this->routeEdgeIndices;
+}
+
+//................................................. Get the target edges ...
+const std::vector<uint32_t>& GARStaticObjData::getTargetEdges(void) const {
+	return this->targetEdges;
+}
+
+//................................................. Get the detector flow targets ...
+const std::vector<int>& GARStaticObjData::getTargetFlows(void) const {
+	return this->targetFlows;
+}
+
+//................................................. Check whether the delta evaluation is enabled ...
+bool GARStaticObjData::isDeltaEvaluation(void) const {
+	return this->deltaEvaluation;
+}
+
+//................................................. Enable or disable the delta evaluation ...
+void GARStaticObjData::setDeltaEvaluation(bool deltaEvaluation) {
+	this->deltaEvaluation = deltaEvaluation;
+}
+
+//................................................. Get the genome score cache ...
+GARFitnessCache* GARStaticObjData::getpFitnessCache(void) const {
+	return this->pFitnessCache;
+}
+
+//................................................. Set the genome score cache ...
+void GARStaticObjData::setpFitnessCache(GARFitnessCache* pFitnessCache) {
+	this->pFitnessCache = pFitnessCache;
+}
+
+//................................................. Get the wrapped crossover operator ...
+GAGenome::SexualCrossover GARStaticObjData::getCrossover(void) const {
+	return this->crossover;
+}
+
+//................................................. Set the wrapped crossover operator ...
+void GARStaticObjData::setCrossover(GAGenome::SexualCrossover crossover) {
+	this->crossover = crossover;
+}
+
+//................................................. Get the number of refined individuals ...
+int GARStaticObjData::getLocalSearchElites(void) const {
+	return this->localSearchElites;
+}
+
+//................................................. Get the number of local search moves ...
+int GARStaticObjData::getLocalSearchMoves(void) const {
+	return this->localSearchMoves;
+}
+
+//................................................. Set the local search budget ...
+void GARStaticObjData::setLocalSearch(int elites, int moves) {
+	this->localSearchElites = elites;
+	this->localSearchMoves = moves;
+}
+
 } /* namespace gar */
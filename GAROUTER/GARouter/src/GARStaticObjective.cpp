@@ -7,6 +7,8 @@
 
 #include <GARStaticObjective.hpp>
 #include <GARStaticObjData.hpp>
+#include <GARStaticEvalData.hpp>
+#include <GARPopulationEvaluator.hpp>
 #include <router/ROEdge.h>
 #include <StringUtilities.hpp>
 #include <boost/format.hpp>
@@ -33,94 +35,186 @@ namespace boost_pt = boost::property_tree;
 
 namespace gar {
 
+//................................................. Static class attributes ...
+thread_local vector<uint32_t> GARStaticObjective::edgeCounts;
+thread_local vector<int> GARStaticObjective::changedGenes;
+thread_local vector<int> GARStaticObjective::staticRoutes;
+thread_local vector<int> GARStaticObjective::countGenes;
+thread_local vector<int32_t> GARStaticObjective::residuals;
+thread_local vector<GAGenome*> GARStaticObjective::elites;
+const int GARStaticObjective::RESIDUAL_TOURNAMENT_SIZE (3);
+
+
 //................................................. The genome objective function ...
+template<class Genome>
 float GARStaticObjective::objective(GAGenome& __genome) {
 	float score = 0.0;
 
 	// Cast to the suitable genome
-	genome_static& genome = (genome_static&)__genome;
+	Genome& genome = (Genome&)__genome;
 
 	// Get the data required by the objective from the genome user data
 	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
 
-	// Compute the flow amounts per edge corresponding to the genome routes
-	map<string,shared_ptr<int>> edgeFlows = getEdgeFlowCounts(pData->getpRouCont(),
-															  genome);
+	// Return the score of the genes already evaluated
+	GARFitnessCache* pCache = pData->getpFitnessCache();
+	Hash128 key;
+	if (pCache != nullptr) {
+		key = genomeKey(genome);
+		if (pCache->find(key, score)) {
+			return score;
+		}
+	}
+
+	if (pData->isDeltaEvaluation()) {
+		// Update the previous evaluation of the genome when the delta evaluation is enabled
+		score = deltaObjective(genome, pData);
+	} else {
+		// Compute the flow amounts per edge corresponding to the genome routes
+		getEdgeFlowCounts(pData, genome, edgeCounts);
+		score = computeScore(pData, edgeCounts);
+	}
 
-	score = computeScore(pData->getpNet(),
-						 pData->getpDetCont(),
-						 pData->getpDetFlows(),
-						 edgeFlows);
+	if (pCache != nullptr) {
+		pCache->insert(key, score);
+	}
 
 	return score;
 }
 
 
-//................................................. Get the flow amounts per edge from the routes in the genome ...
-std::map<std::string, std::shared_ptr<int>> GARStaticObjective::getEdgeFlowCounts(const GARRouteCont const* pRouCont,
-																		   	      const genome_static& genome) {
-	std::map<std::string,std::shared_ptr<int>> edgeFlows;
+//................................................. The count-per-route genome objective function ...
+float GARStaticObjective::countObjective(GAGenome& __genome) {
+	float score = 0.0;
+
+	// Cast to the suitable genome
+	GARCountGenome& genome = (GARCountGenome&)__genome;
+
+	// Get the data required by the objective from the genome user data
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
 
+	// Return the score of the genes already evaluated
+	GARFitnessCache* pCache = pData->getpFitnessCache();
+	Hash128 key;
+	if (pCache != nullptr) {
+		key = genomeKey(genome);
+		if (pCache->find(key, score)) {
+			return score;
+		}
+	}
+
+	// Compute the flow amounts per edge corresponding to the genome route counts
+	getEdgeFlowCounts(pData, genome, edgeCounts);
+	score = computeScore(pData, edgeCounts);
+
+	if (pCache != nullptr) {
+		pCache->insert(key, score);
+	}
+
+	return score;
+}
+
+
+//................................................. Compute the hash key of the genome routes ...
+template<class Genome>
+Hash128 GARStaticObjective::genomeKey(const Genome& genome) {
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+
+	// The score only depends on how many times every route is taken, so the sorted routes
+	// are the same for the wrapped alleles and for the genes swapped within an OD pair
+	staticRoutes.clear();
 	for (int i = 0; i < genome.size(); i++) {
-		string routeName = genome.gene(i);
+		int route = pData->getGeneRoute(i, genome.gene(i));
+		if (route >= 0) {
+			staticRoutes.push_back(route);
+		}
+	}
+	std::sort(staticRoutes.begin(), staticRoutes.end());
+
+	return GARFitnessCache::key(staticRoutes.data(), staticRoutes.size());
+}
+
 
-		// Get the route description corresponding to the route name in the genome
-		std::shared_ptr<const GARRouteDesc> pRd = pRouCont->getRouteDesc(routeName);
-		if (pRd == nullptr) {
+//................................................. Compute the hash key of the count-per-route genome genes ...
+Hash128 GARStaticObjective::genomeKey(const GARCountGenome& genome) {
+	countGenes.resize(genome.length());
+	for (int i = 0; i < genome.length(); i++) {
+		countGenes[i] = genome.gene(i);
+	}
+	return GARFitnessCache::key(countGenes.data(), countGenes.size());
+}
+
+
+//................................................. Get the flow amounts per edge from the routes in the genome ...
+template<class Genome>
+void GARStaticObjective::getEdgeFlowCounts(const GARStaticObjData const* pData,
+										   const Genome& genome,
+										   std::vector<uint32_t>& edgeCounts) {
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+
+	edgeCounts.assign(pData->getNumEdges(), 0);
+
+	for (int i = 0; i < genome.size(); i++) {
+		// Get the route index corresponding to the local route index in the gene
+		int route = pData->getGeneRoute(i, genome.gene(i));
+		if (route < 0) {
 			continue;
 		}
 
 		// Increment flow per edges counter
-		for (const ROEdge const* pEdge : pRd->edges2Pass) {
-			string edgeId = pEdge->getID();
-			std::map<std::string,std::shared_ptr<int>>::iterator it = edgeFlows.find(edgeId);
-			if (it == edgeFlows.end()) {
-				auto ret = edgeFlows.insert(std::pair<string,shared_ptr<int>>(edgeId,std::make_shared<int>(0)));
-				if (ret.second == false) {
-					continue;
-				}
-				it = ret.first;
-			}
-			(*(it->second))++;
+		for (uint32_t k = offsets[route]; k < offsets[route + 1]; k++) {
+			edgeCounts[edges[k]]++;
 		}
 	}
+}
 
-	/*
-	std::cout << "Flows per edge: " << std::endl;
-	for (map<string,shared_ptr<int>>::iterator it = edgeFlows.begin(); it != edgeFlows.end(); it++) {
-		string edgeId = it->first;
-		int accumFlow = *(it->second);
-		std::cout << "edge [" << edgeId << "]: " << accumFlow << std::endl;
-	}
-	*/
 
-	return edgeFlows;
+//................................................. Get the flow amounts per edge from the route counts in the genome ...
+void GARStaticObjective::getEdgeFlowCounts(const GARStaticObjData const* pData,
+										   const GARCountGenome& genome,
+										   std::vector<uint32_t>& edgeCounts) {
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+	const vector<uint32_t>& odRoutes = pData->getOdRoutes();
+
+	edgeCounts.assign(pData->getNumEdges(), 0);
+
+	for (int i = 0; i < genome.length(); i++) {
+		int trips = genome.gene(i);
+		if (trips <= 0) {
+			continue;
+		}
+
+		// Add the route trips to the flow per edges counter
+		uint32_t route = odRoutes[i];
+		for (uint32_t k = offsets[route]; k < offsets[route + 1]; k++) {
+			edgeCounts[edges[k]] += trips;
+		}
+	}
 }
 
 
 //................................................. Compute the flow amount score for the static approach ...
-float GARStaticObjective::computeScore(const GARNet const* pNet,
-									   const GARDetectorCon const* pDetCont,
-									   const GARDetectorFlows const* pDetFlows,
-									   const std::map<std::string,std::shared_ptr<int>>& edgeFlows) {
+float GARStaticObjective::computeScore(const GARStaticObjData const* pData,
+									   const std::vector<uint32_t>& edgeCounts) {
+
+	const vector<uint32_t>& targetEdges = pData->getTargetEdges();
+	const vector<int>& targetFlows = pData->getTargetFlows();
+	size_t t = 0;
 
 	double sum = 0.0;
 	double num = 0.0;
 
-	for (auto edgePair : pNet->getEdgeMap()) {
-		string edgeId = edgePair.first;
-		const ROEdge const* pEdg = edgePair.second;
-		if (pEdg->getType() == ROEdge::EdgeType::ET_INTERNAL) {
-			continue;
-		}
-
+	for (uint32_t e = 0; e < edgeCounts.size(); e++) {
 		// Get the edge occurrences from the genome routes
-		map<string,shared_ptr<int>>::const_iterator it;
-		it = edgeFlows.find(edgeId);
-		int edgSum = (it != edgeFlows.end()) ? *(it->second) : 0;
+		int edgSum = (int)edgeCounts[e];
 
-		// Get the detector flow amount in the edge
-		int detSum = computeDetFlowSumPerEdge(edgeId, pDetCont, pDetFlows);
+		// Get the detector flow amount in the edge (the targets are sorted by edge index)
+		int detSum = 0;
+		if (t < targetEdges.size() && targetEdges[t] == e) {
+			detSum = targetFlows[t++];
+		}
 
 		// Compute the square root difference
 		double sqdiff = std::pow(double(edgSum - detSum), 2);
@@ -136,21 +230,602 @@ float GARStaticObjective::computeScore(const GARNet const* pNet,
 	return score;
 }
 
+//................................................. Compute the score from the squared error sum ...
+float GARStaticObjective::computeScore(int64_t sqErrorSum,
+									   uint32_t numEdges) {
+	double sum = double(sqErrorSum);
+	double num = double(numEdges);
+
+	// The RMSE
+	float rmse = std::sqrt(sum / num);
+	float score = 100.0 / (1.0 + rmse);
+
+	// Return the objective score
+	return score;
+}
+
+
+//................................................. The delta objective function ...
+template<class Genome>
+float GARStaticObjective::deltaObjective(Genome& genome,
+										 const GARStaticObjData const* pData) {
+	GARStaticEvalData* pEval = syncEvalData(genome, pData);
+	return computeScore(pEval->sqErrorSum, pData->getNumEdges());
+}
+
+
+//................................................. Update the evaluation state of a genome ...
+template<class Genome>
+GARStaticEvalData* GARStaticObjective::syncEvalData(Genome& genome,
+													const GARStaticObjData const* pData) {
+	// Attach an evaluation state to the genome on its first update
+	GARStaticEvalData* pEval = dynamic_cast<GARStaticEvalData*>(genome.evalData());
+	if (pEval == nullptr) {
+		genome.evalData(GARStaticEvalData());
+		pEval = dynamic_cast<GARStaticEvalData*>(genome.evalData());
+	}
 
-//................................................. Compute the flow amount score ...
-int GARStaticObjective::computeDetFlowSumPerEdge(const std::string& edgeId,
-									 	   	   	 const GARDetectorCon const* pDetCont,
-												 const GARDetectorFlows const* pDetFlows) {
-	vector<GARDetector*> edgeDetectors = pDetCont->getEdgeDetectors(edgeId);
+	// Recount the genome if there is no previous evaluation to update
+	if (!pEval->isValid() || pEval->genes.size() != (size_t)genome.size()) {
+		computeResiduals(genome, pData, *pEval);
+		return pEval;
+	}
 
-	int flowSum = 0;
+	// Take the genes changed since the last evaluation as recorded by the genetic operators,
+	// or find them if some operator could not record them
+	const vector<int>* pChanged = &pEval->changed;
+	if (!pEval->tracked) {
+		changedGenes.clear();
+		for (int i = 0; i < genome.size(); i++) {
+			if (genome.gene(i) != pEval->genes[i]) {
+				changedGenes.push_back(i);
+			}
+		}
+		pChanged = &changedGenes;
+	}
 
-	for (const GARDetector const* pDet : edgeDetectors) {
-		flowSum += pDetFlows->getFlowSumSecure(pDet->getID());
+	// Recount the genome if most of the genes changed
+	if (pChanged->size() * 2 > (size_t)genome.size()) {
+		computeResiduals(genome, pData, *pEval);
+		return pEval;
 	}
 
-	return flowSum;
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+	vector<int32_t>& residuals = pEval->residuals;
+	int64_t sqErrorSum = pEval->sqErrorSum;
+
+	for (int i : *pChanged) {
+		// A gene may be recorded more than once, or changed back
+		if (genome.gene(i) == pEval->genes[i]) {
+			continue;
+		}
+
+		// Remove the flows of the old route: (r-1)^2 - r^2 = 1 - 2r
+		int oldRoute = pData->getGeneRoute(i, pEval->genes[i]);
+		if (oldRoute >= 0) {
+			for (uint32_t k = offsets[oldRoute]; k < offsets[oldRoute + 1]; k++) {
+				int32_t& r = residuals[edges[k]];
+				sqErrorSum += 1 - 2 * (int64_t)r;
+				r--;
+			}
+		}
+
+		// Add the flows of the new route: (r+1)^2 - r^2 = 2r + 1
+		int newRoute = pData->getGeneRoute(i, genome.gene(i));
+		if (newRoute >= 0) {
+			for (uint32_t k = offsets[newRoute]; k < offsets[newRoute + 1]; k++) {
+				int32_t& r = residuals[edges[k]];
+				sqErrorSum += 2 * (int64_t)r + 1;
+				r++;
+			}
+		}
+
+		pEval->genes[i] = genome.gene(i);
+	}
+
+	pEval->sqErrorSum = sqErrorSum;
+	pEval->commit();
+
+	return pEval;
 }
 
 
+//................................................. Recount the edge flow residuals ...
+template<class Genome>
+void GARStaticObjective::computeResiduals(const Genome& genome,
+										  const GARStaticObjData const* pData,
+										  GARStaticEvalData& evalData) {
+	// Count the flows per edge
+	getEdgeFlowCounts(pData, genome, edgeCounts);
+
+	// Subtract the detector targets
+	evalData.residuals.assign(edgeCounts.begin(), edgeCounts.end());
+	const vector<uint32_t>& targetEdges = pData->getTargetEdges();
+	const vector<int>& targetFlows = pData->getTargetFlows();
+	for (size_t t = 0; t < targetEdges.size(); t++) {
+		evalData.residuals[targetEdges[t]] -= targetFlows[t];
+	}
+
+	// Sum the squared residuals
+	int64_t sqErrorSum = 0;
+	for (int32_t r : evalData.residuals) {
+		sqErrorSum += (int64_t)r * r;
+	}
+
+	// Record the genes the residuals correspond to
+	evalData.genes.resize(genome.size());
+	for (int i = 0; i < genome.size(); i++) {
+		evalData.genes[i] = genome.gene(i);
+	}
+
+	evalData.sqErrorSum = sqErrorSum;
+	evalData.commit();
+}
+
+
+//................................................. The residual-guided mutation operator ...
+template<class Genome>
+int GARStaticObjective::residualMutator(GAGenome& __genome,
+										float pmut) {
+	Genome& genome = (Genome&)__genome;
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+
+	if (pmut <= 0.0 || genome.size() == 0) {
+		return 0;
+	}
+
+	// Mutate as many genes as the flip mutator would
+	int nMut = 0;
+	float expected = pmut * float(genome.size());
+	if (expected < 1.0) {
+		for (int i = 0; i < genome.size(); i++) {
+			if (GAFlip(pmut)) {
+				nMut++;
+			}
+		}
+	} else {
+		nMut = (int)expected;
+	}
+	if (nMut == 0) {
+		return 0;
+	}
+
+	// Start from the evaluation state of the genome with the delta evaluation, so only the
+	// genes changed since its last evaluation are processed, otherwise recount the genome
+	GARStaticEvalData* pEval = nullptr;
+	if (pData->isDeltaEvaluation()) {
+		pEval = syncEvalData(genome, pData);
+	} else {
+		computeEdgeResiduals(pData, genome);
+	}
+	vector<int32_t>& edgeResiduals = (pEval != nullptr) ? pEval->residuals : residuals;
+
+	for (int n = 0; n < nMut; n++) {
+		int gene = pickExcessGene(pData, genome, edgeResiduals);
+		uint32_t numRoutes = pData->getNumGeneRoutes(gene);
+		if (numRoutes == 0) {
+			continue;
+		}
+
+		// Move the gene to the candidate route adding the least error
+		int64_t removed = moveRouteFlows(pData, pData->getGeneRoute(gene, genome.gene(gene)), -1, edgeResiduals);
+		int64_t delta = removed;
+		uint32_t allele = bestGeneAllele(pData, gene, edgeResiduals, delta);
+
+		// Explore a random route if no candidate route reduces the error
+		if (delta >= 0) {
+			allele = (uint32_t)GARandomInt(0, numRoutes - 1);
+		}
+
+		int64_t added = moveRouteFlows(pData, pData->getGeneRoute(gene, allele), 1, edgeResiduals);
+		genome.gene(gene, allele);
+
+		// Keep the evaluation state on the mutated genes
+		if (pEval != nullptr) {
+			pEval->sqErrorSum += removed + added;
+			pEval->genes[gene] = allele;
+		}
+	}
+
+	return nMut;
+}
+
+
+//................................................. The local search ...
+template<class Genome>
+int GARStaticObjective::localSearch(Genome& genome,
+									const GARStaticObjData const* pData,
+									int maxMoves) {
+	if (maxMoves <= 0 || genome.size() == 0) {
+		return 0;
+	}
+
+	// Start from the evaluation state of the genome with the delta evaluation, otherwise
+	// recount the genome
+	GARStaticEvalData* pEval = nullptr;
+	int64_t sqErrorSum = 0;
+	if (pData->isDeltaEvaluation()) {
+		pEval = syncEvalData(genome, pData);
+		sqErrorSum = pEval->sqErrorSum;
+	} else {
+		sqErrorSum = computeEdgeResiduals(pData, genome);
+	}
+	vector<int32_t>& edgeResiduals = (pEval != nullptr) ? pEval->residuals : residuals;
+	int improvements = 0;
+
+	for (int m = 0; m < maxMoves; m++) {
+		int gene = pickExcessGene(pData, genome, edgeResiduals);
+		if (pData->getNumGeneRoutes(gene) < 2) {
+			continue;
+		}
+
+		// Try every candidate route of the gene and keep the best one if it reduces the error
+		uint32_t oldAllele = genome.gene(gene);
+		int64_t delta = moveRouteFlows(pData, pData->getGeneRoute(gene, oldAllele), -1, edgeResiduals);
+		uint32_t allele = bestGeneAllele(pData, gene, edgeResiduals, delta);
+		if (delta >= 0) {
+			allele = oldAllele;
+		} else {
+			sqErrorSum += delta;
+			improvements++;
+		}
+
+		moveRouteFlows(pData, pData->getGeneRoute(gene, allele), 1, edgeResiduals);
+		if (allele != oldAllele) {
+			genome.gene(gene, allele);
+			if (pEval != nullptr) {
+				pEval->genes[gene] = allele;
+			}
+		}
+	}
+
+	// Commit the moves to the evaluation state, so the refined genome is not recounted later
+	if (pEval != nullptr) {
+		pEval->sqErrorSum = sqErrorSum;
+	}
+
+	// The score follows from the residuals, so the improved genome needs no evaluation
+	if (improvements > 0) {
+		genome.score(computeScore(sqErrorSum, pData->getNumEdges()));
+	}
+
+	return improvements;
+}
+
+
+//................................................. The memetic population evaluator ...
+template<class Genome>
+void GARStaticObjective::memeticEvaluator(GAPopulation& pop) {
+	GARPopulationEvaluator::evaluate(pop);
+
+	if (pop.size() == 0) {
+		return;
+	}
+	const GARStaticObjData const* pData = (GARStaticObjData*)pop.individual(0).userData();
+
+	// Take the elites before refining them, since the refined scores change the order
+	int numElites = std::min(pData->getLocalSearchElites(), pop.size());
+	elites.clear();
+	for (int i = 0; i < numElites; i++) {
+		elites.push_back(&pop.best(i, GAPopulation::RAW));
+	}
+
+	for (GAGenome* pGenome : elites) {
+		localSearch((Genome&)*pGenome, pData, pData->getLocalSearchMoves());
+	}
+}
+
+
+//................................................. Compute the edge flow residuals ...
+template<class Genome>
+int64_t GARStaticObjective::computeEdgeResiduals(const GARStaticObjData const* pData,
+												 const Genome& genome) {
+	getEdgeFlowCounts(pData, genome, edgeCounts);
+
+	// Positive on the over-counted edges, negative on the under-counted ones
+	residuals.assign(edgeCounts.begin(), edgeCounts.end());
+	const vector<uint32_t>& targetEdges = pData->getTargetEdges();
+	const vector<int>& targetFlows = pData->getTargetFlows();
+	for (size_t t = 0; t < targetEdges.size(); t++) {
+		residuals[targetEdges[t]] -= targetFlows[t];
+	}
+
+	int64_t sqErrorSum = 0;
+	for (int32_t r : residuals) {
+		sqErrorSum += (int64_t)r * r;
+	}
+
+	return sqErrorSum;
+}
+
+
+//................................................. Pick a gene carrying excess flow ...
+template<class Genome>
+int GARStaticObjective::pickExcessGene(const GARStaticObjData const* pData,
+									   const Genome& genome,
+									   const vector<int32_t>& edgeResiduals) {
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+
+	// The gene whose route carries the largest excess flow out of a few random genes
+	int gene = -1;
+	int64_t maxExcess = 0;
+	for (int k = 0; k < RESIDUAL_TOURNAMENT_SIZE; k++) {
+		int i = GARandomInt(0, genome.size() - 1);
+		int route = pData->getGeneRoute(i, genome.gene(i));
+		int64_t excess = 0;
+		if (route >= 0) {
+			for (uint32_t e = offsets[route]; e < offsets[route + 1]; e++) {
+				excess += std::max(edgeResiduals[edges[e]], 0);
+			}
+		}
+		if (gene < 0 || excess > maxExcess) {
+			gene = i;
+			maxExcess = excess;
+		}
+	}
+
+	return gene;
+}
+
+
+//................................................. Move the flows of a route ...
+int64_t GARStaticObjective::moveRouteFlows(const GARStaticObjData const* pData,
+										   int route,
+										   int sign,
+										   vector<int32_t>& edgeResiduals) {
+	if (route < 0) {
+		return 0;
+	}
+
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+	int64_t delta = 0;
+
+	// Adding: (r+1)^2 - r^2 = 2r + 1, removing: (r-1)^2 - r^2 = 1 - 2r
+	for (uint32_t e = offsets[route]; e < offsets[route + 1]; e++) {
+		int32_t& r = edgeResiduals[edges[e]];
+		delta += 2 * sign * (int64_t)r + 1;
+		r += sign;
+	}
+
+	return delta;
+}
+
+
+//................................................. Find the best candidate route of a gene ...
+uint32_t GARStaticObjective::bestGeneAllele(const GARStaticObjData const* pData,
+											int gene,
+											const vector<int32_t>& edgeResiduals,
+											int64_t& delta) {
+	const vector<uint32_t>& offsets = pData->getRouteEdgeOffsets();
+	const vector<uint32_t>& edges = pData->getRouteEdgeIndices();
+	uint32_t numRoutes = pData->getNumGeneRoutes(gene);
+
+	uint32_t bestAllele = 0;
+	int64_t bestDelta = 0;
+	for (uint32_t a = 0; a < numRoutes; a++) {
+		int route = pData->getGeneRoute(gene, a);
+		int64_t added = 0;
+		for (uint32_t e = offsets[route]; e < offsets[route + 1]; e++) {
+			added += 2 * (int64_t)edgeResiduals[edges[e]] + 1;
+		}
+		if (a == 0 || added < bestDelta) {
+			bestAllele = a;
+			bestDelta = added;
+		}
+	}
+
+	delta += bestDelta;
+
+	return bestAllele;
+}
+
+
+//................................................. The crossover operator for the delta evaluation ...
+template<class Genome>
+int GARStaticObjective::deltaCrossover(const GAGenome& mom,
+									   const GAGenome& dad,
+									   GAGenome* bro,
+									   GAGenome* sis) {
+	const GARStaticObjData const* pData = (GARStaticObjData*)mom.userData();
+
+	// Every child starts from the evaluation state of its parent. A parent scored from the
+	// fitness cache has none, so the child recounts instead of keeping its own stale state
+	if (bro != nullptr) {
+		if (mom.evalData() != nullptr) {
+			bro->evalData(*mom.evalData());
+		} else {
+			invalidateEvalData(*bro);
+		}
+	}
+	if (sis != nullptr) {
+		if (dad.evalData() != nullptr) {
+			sis->evalData(*dad.evalData());
+		} else {
+			invalidateEvalData(*sis);
+		}
+	}
+
+	int numChildren = pData->getCrossover()(mom, dad, bro, sis);
+
+	// Record the genes every child took from the other parent
+	if (bro != nullptr) {
+		recordChanges((const Genome&)mom, (Genome&)*bro);
+	}
+	if (sis != nullptr) {
+		recordChanges((const Genome&)dad, (Genome&)*sis);
+	}
+
+	return numChildren;
+}
+
+
+//................................................. Record the genes a child took from the other parent ...
+template<class Genome>
+void GARStaticObjective::recordChanges(const Genome& parent,
+									   Genome& child) {
+	GARStaticEvalData* pEval = dynamic_cast<GARStaticEvalData*>(child.evalData());
+	if (pEval == nullptr || !pEval->tracked) {
+		return;
+	}
+
+	// The crossover copies the genes anyway, so comparing them adds no cost to the crossover
+	for (int i = 0; i < child.size() && pEval->tracked; i++) {
+		if (child.gene(i) != parent.gene(i)) {
+			pEval->recordChange(i);
+		}
+	}
+}
+
+
+//................................................. The flip mutation operator for the delta evaluation ...
+template<class Genome>
+int GARStaticObjective::flipMutator(GAGenome& __genome,
+									float pmut) {
+	Genome& genome = (Genome&)__genome;
+	GARStaticEvalData* pEval = dynamic_cast<GARStaticEvalData*>(genome.evalData());
+
+	if (pmut <= 0.0) {
+		return 0;
+	}
+
+	// The flip mutator of GAlib, recording the mutated genes
+	float nMut = pmut * float(genome.length());
+	if (nMut < 1.0) {
+		nMut = 0;
+		for (int i = genome.length() - 1; i >= 0; i--) {
+			if (GAFlip(pmut)) {
+				genome.gene(i, genome.alleleset(i).allele());
+				if (pEval != nullptr) {
+					pEval->recordChange(i);
+				}
+				nMut++;
+			}
+		}
+	} else {
+		for (int n = 0; n < nMut; n++) {
+			int i = GARandomInt(0, genome.length() - 1);
+			genome.gene(i, genome.alleleset(i).allele());
+			if (pEval != nullptr) {
+				pEval->recordChange(i);
+			}
+		}
+	}
+
+	return (int)nMut;
+}
+
+
+//................................................. The swap mutation operator for the delta evaluation ...
+template<class Genome>
+int GARStaticObjective::swapMutator(GAGenome& __genome,
+									float pmut) {
+	Genome& genome = (Genome&)__genome;
+	GARStaticEvalData* pEval = dynamic_cast<GARStaticEvalData*>(genome.evalData());
+
+	if (pmut <= 0.0) {
+		return 0;
+	}
+
+	// The swap mutator of GAlib, with the partner drawn among the genes of the same OD pair,
+	// since a gene value is a local route index within its OD pair. Records the swapped genes
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+	const vector<uint32_t>& geneOffsets = pData->getOdGeneOffsets();
+
+	auto swap = [&genome, pEval, pData, &geneOffsets] (int i) {
+		uint32_t od = pData->getGeneOd(i);
+		int j = GARandomInt((int)geneOffsets[od], (int)geneOffsets[od + 1] - 1);
+		genome.swap(i, j);
+		if (pEval != nullptr) {
+			pEval->recordChange(i);
+			pEval->recordChange(j);
+		}
+	};
+
+	int last = genome.length() - 1;
+	float nMut = pmut * float(genome.length());
+	if (nMut < 1.0) {
+		nMut = 0;
+		for (int i = last; i >= 0; i--) {
+			if (GAFlip(pmut)) {
+				swap(i);
+				nMut++;
+			}
+		}
+	} else {
+		for (int n = 0; n < nMut; n++) {
+			swap(GARandomInt(0, last));
+		}
+	}
+
+	return (int)nMut;
+}
+
+
+//................................................. The uniform initializer for the delta evaluation ...
+template<class Genome>
+void GARStaticObjective::uniformInitializer(GAGenome& genome) {
+	Genome::UniformInitializer(genome);
+	invalidateEvalData(genome);
+}
+
+//................................................. The ordered initializer for the delta evaluation ...
+template<class Genome>
+void GARStaticObjective::orderedInitializer(GAGenome& __genome) {
+	Genome& genome = (Genome&)__genome;
+	const GARStaticObjData const* pData = (GARStaticObjData*)genome.userData();
+	const vector<uint32_t>& geneOffsets = pData->getOdGeneOffsets();
+
+	// The ordered initializer of GAlib within every OD pair: the local route indices in turn,
+	// shuffled among the genes of the OD pair only
+	for (size_t od = 0; od + 1 < geneOffsets.size(); od++) {
+		int first = (int)geneOffsets[od];
+		int last = (int)geneOffsets[od + 1] - 1;
+		if (last < first) {
+			continue;
+		}
+
+		uint32_t numRoutes = std::max(pData->getNumGeneRoutes(first), 1u);
+		for (int i = first; i <= last; i++) {
+			genome.gene(i, (uint32_t)(i - first) % numRoutes);
+		}
+		for (int i = first; i <= last; i++) {
+			genome.swap(i, GARandomInt(first, last));
+		}
+	}
+
+	invalidateEvalData(genome);
+}
+
+//................................................. Invalidate the evaluation state of a genome ...
+void GARStaticObjective::invalidateEvalData(GAGenome& genome) {
+	GARStaticEvalData* pEval = dynamic_cast<GARStaticEvalData*>(genome.evalData());
+	if (pEval != nullptr) {
+		pEval->invalidate();
+	}
+}
+
+
+//................................................. Instantiate the trip genome functions ...
+#define GAR_INSTANTIATE_TRIP_GENOME(Genome) \
+	template float GARStaticObjective::objective<Genome>(GAGenome&); \
+	template void GARStaticObjective::getEdgeFlowCounts<Genome>(const GARStaticObjData const*, const Genome&, vector<uint32_t>&); \
+	template float GARStaticObjective::deltaObjective<Genome>(Genome&, const GARStaticObjData const*); \
+	template void GARStaticObjective::computeResiduals<Genome>(const Genome&, const GARStaticObjData const*, GARStaticEvalData&); \
+	template GARStaticEvalData* GARStaticObjective::syncEvalData<Genome>(Genome&, const GARStaticObjData const*); \
+	template int GARStaticObjective::deltaCrossover<Genome>(const GAGenome&, const GAGenome&, GAGenome*, GAGenome*); \
+	template int GARStaticObjective::flipMutator<Genome>(GAGenome&, float); \
+	template int GARStaticObjective::swapMutator<Genome>(GAGenome&, float); \
+	template void GARStaticObjective::uniformInitializer<Genome>(GAGenome&); \
+	template void GARStaticObjective::orderedInitializer<Genome>(GAGenome&); \
+	template int GARStaticObjective::residualMutator<Genome>(GAGenome&, float); \
+	template int GARStaticObjective::localSearch<Genome>(Genome&, const GARStaticObjData const*, int); \
+	template void GARStaticObjective::memeticEvaluator<Genome>(GAPopulation&); \
+	template Hash128 GARStaticObjective::genomeKey<Genome>(const Genome&);
+
+GAR_INSTANTIATE_TRIP_GENOME(genome_static)
+GAR_INSTANTIATE_TRIP_GENOME(genome_static_wide)
+
 } /* namespace gar */
@@ -0,0 +1,120 @@
+/*
+ * GARSumoWorkerPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#include <GARSumoWorkerPool.hpp>
+#include <GARDynObjective.hpp>
+#include <StringUtilities.hpp>
+#include <boost/filesystem.hpp>
+
+using std::string;
+using std::vector;
+using std::mutex;
+using std::unique_lock;
+using std::lock_guard;
+using common::StringUtilities;
+
+namespace boost_fs = boost::filesystem;
+
+
+namespace gar {
+
+//................................................. Parameterized constructor ...
+GARSumoWorkerPool::GARSumoWorkerPool(CLogger* logger)
+: sandboxes (vector<GARSumoSandbox>()),
+  idle      (vector<const GARSumoSandbox*>()),
+  logger    (logger) {
+	// Intentionally left empty
+}
+
+//................................................. Destructor ...
+GARSumoWorkerPool::~GARSumoWorkerPool(void) {
+	removeSandboxes();
+}
+
+
+//................................................. Create the worker sandboxes ...
+int GARSumoWorkerPool::createSandboxes(unsigned int numWorkers, const string& loopFile) {
+	removeSandboxes();
+
+	try {
+		for (unsigned int i = 0; i < numWorkers; i++) {
+			boost_fs::path dir = boost_fs::temp_directory_path() / boost_fs::unique_path("gar_worker_%%%%-%%%%-%%%%");
+			boost_fs::create_directories(dir);
+
+			GARSumoSandbox sandbox;
+			sandbox.dir      = dir.string();
+			sandbox.loopFile = (dir / "induction_loops.add.xml").string();
+			sandbox.emitFile = (dir / "emitters.add.xml").string();
+			sandbox.measFile = (dir / GARDynObjective::GAR_LOOP_MEAS_FILE).string();
+			sandboxes.push_back(sandbox);
+
+			// The loop measurements are written next to the copy of the induction loop file
+			boost_fs::copy_file(loopFile, sandbox.loopFile, boost_fs::copy_option::overwrite_if_exists);
+
+			logger->debug("Created SUMO worker sandbox [" + sandbox.dir + "]");
+		}
+	} catch (const boost_fs::filesystem_error& ex) {
+		logger->error("Fail to create the SUMO worker sandboxes: " + string(ex.what()));
+		removeSandboxes();
+		return 1;
+	}
+
+	lock_guard<mutex> lock(mtx);
+	for (const GARSumoSandbox& sandbox : sandboxes) {
+		idle.push_back(&sandbox);
+	}
+
+	logger->info("Created [" + StringUtilities::toString<int>(sandboxes.size()) + "] SUMO worker sandboxes");
+
+	return 0;
+}
+
+
+//................................................. Get the number of sandboxes ...
+unsigned int GARSumoWorkerPool::size(void) const {
+	return sandboxes.size();
+}
+
+
+//................................................. Acquire an idle sandbox ...
+const GARSumoSandbox* GARSumoWorkerPool::acquire(void) {
+	unique_lock<mutex> lock(mtx);
+	idleCond.wait(lock, [this] () { return !idle.empty(); });
+
+	const GARSumoSandbox* pSandbox = idle.back();
+	idle.pop_back();
+
+	return pSandbox;
+}
+
+
+//................................................. Release a sandbox ...
+void GARSumoWorkerPool::release(const GARSumoSandbox* pSandbox) {
+	{
+		lock_guard<mutex> lock(mtx);
+		idle.push_back(pSandbox);
+	}
+	idleCond.notify_one();
+}
+
+
+//................................................. Remove the sandboxes ...
+void GARSumoWorkerPool::removeSandboxes(void) {
+	for (const GARSumoSandbox& sandbox : sandboxes) {
+		boost::system::error_code ec;
+		boost_fs::remove_all(sandbox.dir, ec);
+		if (ec) {
+			logger->warning("Fail to remove the SUMO worker sandbox [" + sandbox.dir + "]: " + ec.message());
+		}
+	}
+
+	lock_guard<mutex> lock(mtx);
+	idle.clear();
+	sandboxes.clear();
+}
+
+} /* namespace gar */
@@ -12,20 +12,27 @@
 #include <GARScalingFactory.hpp>
 #include <GARSelectionFactory.hpp>
 #include <GARStaticObjective.hpp>
+#include <GARCountGenome.hpp>
 #include <GARDynObjective.hpp>
+#include <GARPopulationEvaluator.hpp>
+#include <GARIslandGA.hpp>
+#include <GARAsyncGA.hpp>
 #include <router/ROLane.h>
 #include <utils/common/SystemFrame.h>
 #include <utils/xml/XMLSubSys.h>
 #include <StringUtilities.hpp>
+#include <ThreadPool.hpp>
 #include <CDump.hpp>
-#include <YenTopKShortestPathsAlg.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include <boost/filesystem.hpp>
 #include <random>
+#include <sstream>
 #include <ctime>
 #include <algorithm> // std::reverse
+#include <limits>
 #include <typeinfo>  // std::bad_cast
+#include <ga/garandom.h>
 
 using common::CLogger;
 using common::StringUtilities;
@@ -33,6 +40,7 @@ using common::CDump;
 using std::string;
 using std::vector;
 using std::map;
+using std::pair;
 using std::unique_ptr;
 using std::shared_ptr;
 using std::ofstream;
@@ -68,6 +76,16 @@ GARouter::GARouter(const OptionsCont& optCont,
   pDynGenome	  (nullptr),
   pDynObjData     (unique_ptr<GARDynObjData>(new GARDynObjData(logger))),
   pDynSolution    (nullptr),
+  pWorkerPool     (nullptr),
+  pMesoSim        (nullptr),
+  pLoopReader     (nullptr),
+  pStaticCache    (nullptr),
+  pDynCache       (nullptr),
+  pSimStore       (nullptr),
+  pCheckpoint     (nullptr),
+  gaSeed          (0),
+  pTerminator     (nullptr),
+  incumbentTime   (std::chrono::steady_clock::now()),
   alleles         (vector<string>()),
   scoreFilename   ("./gar_stats.dat") {
 	// Empty constructor
@@ -151,27 +169,58 @@ int GARouter::computeKShortestRoutes(void) {
 
 	logger->error("Compute the k='" + StringUtilities::toString<int>(k) + "' shortest routes");
 	try {
-		Graph graph = this->buildKShortestGraph();
+		GARKShortestGraph kGraph = this->buildKShortestGraph();
 
 		// Get the source and sink detectors
 		vector<GARDetector*> sources = pDetCont->getDetectorsByType(SOURCE_DETECTOR);
 		vector<GARDetector*> sinks = pDetCont->getDetectorsByType(SINK_DETECTOR);
 
-		// Compute shortest paths between from source nodes and to sink nodes
+		// Get the pairs of source and sink detectors, leaving out source and sink edges in the same district group
+		vector<pair<const GARDetector*, const GARDetector*>> detPairs;
 		for (const GARDetector const* pSourceDet : sources) {
 			for (const GARDetector const* pSinkDet : sinks) {
-				// Leave out source and sink edges in the same district group
 				shared_ptr<const GARTazGroup> sourceGroup = pTazCont->findSourceEdgeGroup(pSourceDet->getEdgeID());
 				shared_ptr<const GARTazGroup> sinkGroup = pTazCont->findSinkEdgeGroup(pSinkDet->getEdgeID());
 				if (sourceGroup->getId() == sinkGroup->getId()) {
 					continue;
 				}
+				detPairs.push_back(std::make_pair(pSourceDet, pSinkDet));
+			}
+		}
+
+		// Get the number of threads computing the shortest paths
+		int numThreads = options.isSet("k-shortest-threads") ? options.getInt("k-shortest-threads") : 1;
+		if (numThreads < 1) {
+			logger->error("Invalid number of k-shortest threads [" + StringUtilities::toString<int>(numThreads) + "]");
+			return 1;
+		}
+
+		// Compute the shortest paths of the detector pairs concurrently.
+		// Every block of pairs runs its own Yen's algorithm on the shared read-only graph.
+		vector<vector<GARRouteDesc>> pairRoutes(detPairs.size());
+		const size_t numBlocks = std::min(detPairs.size(), size_t(numThreads > 1 ? numThreads * 8 : 1));
+		common::ThreadPool pool(numThreads);
+		pool.parallelFor(numBlocks, [&] (size_t block) {
+			CSRYenKShortestPathsAlg shortestPaths (kGraph.graph);
+			for (size_t i = block * detPairs.size() / numBlocks; i < (block + 1) * detPairs.size() / numBlocks; i++) {
+				pairRoutes[i] = getKShortestRoutes(kGraph, shortestPaths, detPairs[i].first, detPairs[i].second, k);
+			}
+		});
 
-				vector<GARRouteDesc> shortestRoutes = getKShortestRoutes(graph, pSourceDet, pSinkDet, k, kSelected);
+		// Add the shortest routes to the route and trip containers in the detector pair order
+		for (size_t i = 0; i < detPairs.size(); i++) {
+			const GARDetector const* pSourceDet = detPairs[i].first;
+			const GARDetector const* pSinkDet = detPairs[i].second;
 
-				// Add the shortest routes to the route and trip containers
-				addKShortestRoutes(shortestRoutes, pSourceDet, pSinkDet);
+			if (logger->isDebugEnabled()) {
+				logger->debug("Shortest paths from [" + pSourceDet->getEdgeID() + "] to [" + pSinkDet->getEdgeID() + "]");
+				for (const GARRouteDesc& rd : pairRoutes[i]) {
+					logger->debug("\tPath [" + rd.routename + "]");
+				}
 			}
+
+			vector<GARRouteDesc> shortestRoutes = getSelectedRoutes(pairRoutes[i], kSelected);
+			addKShortestRoutes(shortestRoutes, pSourceDet, pSinkDet);
 		}
 	} catch (const std::exception& ex) {
 		logger->error("Fail to compute the '" + StringUtilities::toString<int>(k) + "' shortest paths: " + string(ex.what()));
@@ -190,12 +239,27 @@ int GARouter::computeRoutesBetweenDetectors(void) {
 
 	try {
 		if (!pDetCont->detectorsHaveRoutes()  ||  options.getBool("revalidate-routes")) {
+			// Get the number of threads searching the routes of the source edges
+			int numThreads = options.isSet("route-threads") ? options.getInt("route-threads") : 1;
+			if (numThreads < 1) {
+				logger->error("Invalid number of route threads [" + StringUtilities::toString<int>(numThreads) + "]");
+				return 1;
+			}
+
+			// Get the limits of the route search
+			GARNet::RouteSearchLimits limits;
+			limits.dominance = options.isSet("route-dominance") && options.getBool("route-dominance");
+			limits.maxLabels = options.isSet("route-max-labels") ? std::max(options.getInt("route-max-labels"), 0) : 0;
+			limits.memoryBudget = options.isSet("route-memory-budget") ? size_t(std::max(options.getInt("route-memory-budget"), 0)) << 20 : 0;
+
 			PROGRESS_BEGIN_MESSAGE("Computing routes");
 			pNet->buildRoutes(*pDetCont,
 							  *pTazCont,
 							  *pRouCont,
 							  *pTripCont,
 							  options.getInt("max-search-depth"),
+							  limits,
+							  numThreads,
 							  logger);
 			PROGRESS_DONE_MESSAGE();
 		}
@@ -276,6 +340,34 @@ int GARouter::buildGAStaticObjectiveData(void) {
 		return 1;
 	}
 
+	// Build the route-to-edge incidence used to count the edge flows
+	logger->info("Build the route-edge incidence of the objective data");
+	if (pStaticObjData->buildRouteEdgeIncidence() > 0) {
+		return 1;
+	}
+
+	// Build the detector flow targets the edge flows are matched against
+	logger->info("Build the detector targets of the objective data");
+	if (pStaticObjData->buildDetectorTargets() > 0) {
+		return 1;
+	}
+
+	// Cache the scores of the genomes already evaluated
+	if (options.isSet("fitness-cache") && options.getInt("fitness-cache") > 0) {
+		logger->info("Set a score cache of [" + StringUtilities::toString<int>(options.getInt("fitness-cache")) + "] genomes to objective data");
+		pStaticCache = std::unique_ptr<GARFitnessCache>(new GARFitnessCache(options.getInt("fitness-cache")));
+		pStaticObjData->setpFitnessCache(pStaticCache.get());
+	}
+
+	// Refine the best individuals with a local search
+	if (options.isSet("local-search-elites") && options.getInt("local-search-elites") > 0) {
+		int elites = options.getInt("local-search-elites");
+		int moves = options.isSet("local-search-moves") ? options.getInt("local-search-moves") : 0;
+		logger->info("Set a local search of [" + StringUtilities::toString<int>(moves) + "] moves on the ["
+					 + StringUtilities::toString<int>(elites) + "] best individuals to objective data");
+		pStaticObjData->setLocalSearch(elites, moves);
+	}
+
 	return 0;
 }
 
@@ -288,21 +380,56 @@ int GARouter::buildGAStaticGenome(void) {
 	}
 
 	try {
-		// Build the allele set array
-		GAAlleleSetArray<const char*> alleleArray = buildGAStaticAlleleSetArray();
-		if (alleleArray.size() == 0) {
+		// Build the gene layout of the objective data
+		if (buildGAStaticGeneLayout() > 0) {
+			return 1;
+		}
+		if (pStaticObjData->getNumGenes() == 0) {
 			return 0;
 		}
 
-		// Build the genome for the static approach
-		pStaticGenome = std::unique_ptr<genome_static>(new genome_static(alleleArray,
-														  	   	   	     GARStaticObjective::objective,
-																		 pStaticObjData.get()));
+		string encoding = options.isSet("static-encoding") ? options.getString("static-encoding") : "trip";
 
-		// Set the genetic operators
-		setGAGenomeInitializer(pStaticGenome.get());
-		setGAGenomeMutator(pStaticGenome.get());
-		setGAGenomeCrossover(pStaticGenome.get());
+		if (StringUtilities::trim(encoding) == "count") {
+			// Build the count-per-route genome, which carries its own genetic operators
+			logger->info("Build the count-per-route genome for the static approach");
+			pStaticGenome = std::unique_ptr<GAGenome>(new GARCountGenome(pStaticObjData.get(),
+																		 GARStaticObjective::countObjective));
+
+		} else {
+			if (StringUtilities::trim(encoding) != "trip") {
+				logger->warning("Unknown static encoding [" + encoding + "]. Set the 'trip' encoding by default.");
+			}
+
+			if (pStaticObjData->getMaxOdRoutes() > std::numeric_limits<uint16_t>::max() + 1u) {
+				// Fall back to 32-bit alleles when the local route indices of some OD pair don't fit 16 bits
+				logger->warning("An OD pair has [" + StringUtilities::toString<uint32_t>(pStaticObjData->getMaxOdRoutes())
+								+ "] candidate routes, build the genome for the static approach with 32-bit alleles");
+				GAAlleleSetArray<uint32_t> alleleArray = buildGAStaticAlleleSetArray<uint32_t>();
+				if (alleleArray.size() == 0) {
+					return 0;
+				}
+				pStaticGenome = std::unique_ptr<GAGenome>(new genome_static_wide(alleleArray,
+																				 GARStaticObjective::objective<genome_static_wide>,
+																				 pStaticObjData.get()));
+			} else {
+				// Build the allele set array
+				GAAlleleSetArray<uint16_t> alleleArray = buildGAStaticAlleleSetArray<uint16_t>();
+				if (alleleArray.size() == 0) {
+					return 0;
+				}
+
+				// Build the genome for the static approach
+				pStaticGenome = std::unique_ptr<GAGenome>(new genome_static(alleleArray,
+																			GARStaticObjective::objective<genome_static>,
+																			pStaticObjData.get()));
+			}
+
+			// Set the genetic operators
+			setGAGenomeInitializer(pStaticGenome.get());
+			setGAGenomeMutator(pStaticGenome.get());
+			setGAGenomeCrossover(pStaticGenome.get());
+		}
 
 	} catch (const std::exception& ex) {
 		logger->error("Fail to build genome for the static approach: " + string(ex.what()));
@@ -375,6 +502,15 @@ int GARouter::buildGAStaticGeneticAlgorithm(void) {
 		}
 	}
 
+	// Set the islands and the migration scheme for island GA
+	if (gaType == "Island") {
+		logger->info(">> Set the Island Model");
+		result = setGAIslandModel(pGAStatic.get());
+		if (result > 0) {
+			return result;
+		}
+	}
+
 	return 0;
 }
 
@@ -404,24 +540,65 @@ int GARouter::evolveStaticGA(void) {
 		string scoreFile = buildScoreFileName("static_");
 		pGAStatic->scoreFilename(scoreFile.c_str());
 
+		// The genetic operators of the 16 or 32-bit trip genome
+		bool wide = (typeid(*pStaticGenome) == typeid(genome_static_wide));
+		bool trip = wide || typeid(*pStaticGenome) == typeid(genome_static);
+		GAGenome::SexualCrossover deltaCrossover = wide ? GARStaticObjective::deltaCrossover<genome_static_wide>
+														: GARStaticObjective::deltaCrossover<genome_static>;
+
+		// The permutation crossovers move the gene values, local route indices, between the OD pairs
+		string crossover = StringUtilities::trim(options.getString("genome-crossover"));
+		if (trip && (crossover == "Cycle" || crossover == "Order" || crossover == "PartialMatch")) {
+			logger->warning("The [" + crossover + "] crossover moves gene values between OD pairs of the trip genome, "
+							"the values out of the candidate routes of an OD pair are wrapped around");
+		}
+
+		// Evaluate the genomes incrementally: every child starts from the evaluation of its parent
+		if (options.isSet("delta-evaluation") && options.getBool("delta-evaluation")
+				&& trip && pGAStatic->sexual() != deltaCrossover) {
+			logger->info("Enable the delta evaluation for the static approach");
+			pStaticObjData->setCrossover(pGAStatic->sexual());
+			pStaticObjData->setDeltaEvaluation(true);
+			pGAStatic->crossover(deltaCrossover);
+		}
+
+		// Refine the best individuals of every evaluated population with a local search
+		if (pStaticObjData->getLocalSearchElites() > 0) {
+			if (!trip) {
+				logger->warning("The local search only applies to the trip genome of the static approach");
+			} else if (dynamic_cast<GASimpleGA*>(pGAStatic.get()) == nullptr) {
+				// The other algorithms evaluate their children out of the main population evaluator
+				logger->warning("The local search only applies to the Simple genetic algorithm, not to the ["
+								+ string(pGAStatic->className()) + "] one");
+			} else {
+				logger->info("Enable the local search for the static approach");
+				GAPopulation pop(pGAStatic->population());
+				pop.evaluator(wide ? GARStaticObjective::memeticEvaluator<genome_static_wide>
+								   : GARStaticObjective::memeticEvaluator<genome_static>);
+				pGAStatic->population(pop);
+			}
+		}
+
+		// Start the clock of the time budget
+		if (pTerminator != nullptr) {
+			pTerminator->start();
+		}
+		incumbentTime = std::chrono::steady_clock::now();
+
 		// Initialize the genetic algorithm using a seed if reported
 		logger->info("Initializing the GA for the static approach...");
-		if (options.isSet("ga-seed")) {
-			pGAStatic->initialize(options.getInt("ga-seed"));
-		} else {
-			pGAStatic->initialize();
+		if (initializeGA(pGAStatic.get(), GARCheckpoint::STATIC) > 0) {
+			return 1;
 		}
 
 		// Print the initial population
-		logger->debug("Initial population:");
-		for (int i = 0; i < pGAStatic->populationSize(); i++) {
-			string sGenome = "";
-			const genome_static& genome = (genome_static&)pGAStatic->population().individual(i);
-
-			for (int j = 0; j < genome.size(); j++) {
-				sGenome += string(genome.gene(j)) + " ";
+		if (logger->isDebugEnabled()) {
+			logger->debug("Initial population:");
+			for (int i = 0; i < pGAStatic->populationSize(); i++) {
+				std::ostringstream sGenome;
+				sGenome << pGAStatic->population().individual(i);
+				logger->debug("Genome " + StringUtilities::toString<int>(i) + ": " + sGenome.str());
 			}
-			logger->debug("Genome " + StringUtilities::toString<int>(i) + ": " + sGenome);
 		}
 
 		// Evolve the genetic algorithm
@@ -433,6 +610,10 @@ int GARouter::evolveStaticGA(void) {
 
 		while (!pGAStatic->done()) {
 			pGAStatic->step();
+			if (checkpointGA(pGAStatic.get(), GARCheckpoint::STATIC) > 0) {
+				return 1;
+			}
+			publishIncumbent(pGAStatic.get(), GARCheckpoint::STATIC, false);
 			std::cout << ".";
 			if (pGAStatic->generation() % 10 == 0) {
 				std::cout << pGAStatic->generation() << std::endl;
@@ -447,8 +628,21 @@ int GARouter::evolveStaticGA(void) {
 
 		std::cout << "Processing time: " << (end - begin) << " seconds" << std::endl;
 
+		// Wait for the evaluations still in flight
+		stopGAWorkers(pGAStatic.get());
+
+		// Publish the final solution, and why the evolution stopped before the last generation
+		publishIncumbent(pGAStatic.get(), GARCheckpoint::STATIC, true);
+		if (pTerminator != nullptr && !pTerminator->getReason().empty()) {
+			logger->info("Evolution stopped at generation [" + StringUtilities::toString<int>(pGAStatic->generation())
+						 + "]: " + pTerminator->getReason());
+		}
+
+		// Report the score cache usage
+		reportFitnessCache(pStaticCache.get());
+
 		// Get the best solution
-		const genome_static& best = (genome_static&) pGAStatic->statistics().bestIndividual();
+		const GAGenome& best = pGAStatic->statistics().bestIndividual();
 
 		// Register the GA static solution
 		setStaticSolution(best);
@@ -463,21 +657,75 @@ int GARouter::evolveStaticGA(void) {
 
 
 //................................................. Set the static solution ...
-void GARouter::setStaticSolution(const genome_static& best) {
-	if (best.size() > 0) {
-		pStaticSolution = std::unique_ptr<genome_static>(new genome_static(best));
-	}
+void GARouter::setStaticSolution(const GAGenome& best) {
+	pStaticSolution = std::unique_ptr<GAGenome>(best.clone());
 }
 
 
 //................................................. Get the static solution ...
-genome_static GARouter::getStaticSolution(void) const {
-	if (pStaticSolution != nullptr) {
-		return *pStaticSolution;
+const GAGenome const* GARouter::getStaticSolution(void) const {
+	return pStaticSolution.get();
+}
+
+
+//................................................. Decode the static solution into route indices ...
+vector<uint32_t> GARouter::decodeStaticSolution(void) const {
+	if (pStaticSolution == nullptr) {
+		return vector<uint32_t>();
+	}
+
+	return decodeStaticSolution(*pStaticSolution);
+}
+
+
+//................................................. Resolve the genes of a trip genome into routes ...
+template<class Genome>
+static void decodeTripGenome(const GARStaticObjData const* pData, const Genome& genome, vector<uint32_t>& routes) {
+	routes.reserve(genome.size());
+	for (int i = 0; i < genome.size(); i++) {
+		int route = pData->getGeneRoute(i, genome.gene(i));
+		if (route < 0) {
+			continue;
+		}
+		routes.push_back((uint32_t)route);
+	}
+}
+
+
+//................................................. Decode a static genome into route indices ...
+vector<uint32_t> GARouter::decodeStaticSolution(const GAGenome& genome) const {
+	vector<uint32_t> routes;
+
+	if (typeid(genome) == typeid(GARCountGenome)) {
+		// Repeat every candidate route as many times as trips it carries
+		const GARCountGenome& solution = (const GARCountGenome&)genome;
+		const vector<uint32_t>& odRoutes = pStaticObjData->getOdRoutes();
+		for (int i = 0; i < solution.length(); i++) {
+			routes.insert(routes.end(), (size_t)std::max(solution.gene(i), 0), odRoutes[i]);
+		}
+		return routes;
 	}
 
-	// Return an empty genome
-	return genome_static(0, GAAlleleSet<const char*>());
+	// Resolve every gene into the route it selects
+	if (typeid(genome) == typeid(genome_static_wide)) {
+		decodeTripGenome(pStaticObjData.get(), (const genome_static_wide&)genome, routes);
+	} else {
+		decodeTripGenome(pStaticObjData.get(), (const genome_static&)genome, routes);
+	}
+
+	return routes;
+}
+
+
+//................................................. Decode the static solution ...
+vector<string> GARouter::getStaticSolutionRoutes(void) const {
+	vector<string> routeNames;
+
+	for (uint32_t route : decodeStaticSolution()) {
+		routeNames.push_back(pStaticObjData->getRouteDesc(route).routename);
+	}
+
+	return routeNames;
 }
 
 
@@ -485,18 +733,12 @@ genome_static GARouter::getStaticSolution(void) const {
 void GARouter::printStaticSolution(void) const {
 	// Print the best individual resulting from the GA evolution for the static approach
 	std::cout << "Best solution:" << std::endl;
-	for (int i = 0; i < pStaticSolution->size(); i++) {
-		string routename = pStaticSolution->gene(i);
-
-		std::cout << routename << std::endl;
-
-		std::shared_ptr<const GARRouteDesc> pRd = pStaticObjData->getpRouCont()->getRouteDesc(routename);
-		if (pRd == nullptr) {
-			continue;
-		}
+	for (uint32_t route : decodeStaticSolution()) {
+		const GARRouteDesc& rd = pStaticObjData->getRouteDesc(route);
+		std::cout << rd.routename << std::endl;
 
 		// Print the route edges
-		for (const ROEdge const* pEdge : pRd->edges2Pass) {
+		for (const ROEdge const* pEdge : rd.edges2Pass) {
 			std::cout << std::setw(12) << pEdge->getID();
 		}
 		std::cout << std::endl;
@@ -530,6 +772,212 @@ bool GARouter::triggerDynamicGA(void) const {
 }
 
 
+//................................................. Load the checkpoint to resume from ...
+int GARouter::loadCheckpoint(void) {
+	if (!options.isSet("resume") || !options.getBool("resume")) {
+		return 0;
+	}
+
+	string path = options.getString("checkpoint-file");
+	logger->info("Load the checkpoint [" + path + "] to resume the evolution from");
+
+	pCheckpoint = std::unique_ptr<GARCheckpoint>(new GARCheckpoint(logger));
+	if (pCheckpoint->load(path) > 0) {
+		pCheckpoint = nullptr;
+		return 1;
+	}
+
+	if (pCheckpoint->getApproach() == GARCheckpoint::DYNAMIC && !pCheckpoint->hasStaticSolution()) {
+		logger->error("The dynamic checkpoint [" + path + "] keeps no static solution");
+		pCheckpoint = nullptr;
+		return 1;
+	}
+
+	logger->info("Resume the " + string(pCheckpoint->getApproach() == GARCheckpoint::STATIC ? "static" : "dynamic")
+				 + " approach from generation [" + StringUtilities::toString<uint32_t>(pCheckpoint->getGeneration()) + "]");
+	return 0;
+}
+
+
+//................................................. Check whether the run resumes the dynamic approach ...
+bool GARouter::resumesDynamicGA(void) const {
+	return pCheckpoint != nullptr && pCheckpoint->getApproach() == GARCheckpoint::DYNAMIC;
+}
+
+
+//................................................. Restore the static solution from the checkpoint ...
+int GARouter::restoreStaticSolution(void) {
+	if (!resumesDynamicGA() || pStaticGenome == nullptr) {
+		logger->error("There is no static solution to restore");
+		return 1;
+	}
+
+	std::unique_ptr<GAGenome> pSolution (pStaticGenome->clone());
+	if (pCheckpoint->restoreStaticSolution(*pSolution) > 0) {
+		logger->error("The static solution of the checkpoint doesn't fit the static genome");
+		return 1;
+	}
+	setStaticSolution(*pSolution);
+
+	return 0;
+}
+
+
+//................................................. Initialize a genetic algorithm ...
+int GARouter::initializeGA(GAGeneticAlgorithm* pGA, GARCheckpoint::Approach approach) {
+	bool resume = (pCheckpoint != nullptr && pCheckpoint->getApproach() == approach);
+	bool checkpoint = options.isSet("checkpoint-interval") && options.getInt("checkpoint-interval") > 0;
+
+	if (!resume && !checkpoint) {
+		if (options.isSet("ga-seed")) {
+			pGA->initialize(options.getInt("ga-seed"));
+		} else {
+			pGA->initialize();
+		}
+		return 0;
+	}
+
+	// The other algorithms keep state out of the population
+	if (dynamic_cast<GARCheckpointable*>(pGA) == nullptr) {
+		logger->error("The [" + string(pGA->className()) + "] genetic algorithm can't be checkpointed");
+		return 1;
+	}
+
+	if (!resume) {
+		// The run is seeded explicitly so a resumed run can derive its seed
+		gaSeed = (options.isSet("ga-seed") && options.getInt("ga-seed") != 0) ? options.getInt("ga-seed") : (uint32_t)time(NULL);
+		logger->info("Seed the checkpointed evolution with [" + StringUtilities::toString<uint32_t>(gaSeed) + "]");
+		pGA->initialize(gaSeed);
+		return 0;
+	}
+
+	if (pCheckpoint->getPopulationSize() != pGA->populationSize()) {
+		logger->error("The checkpoint population size [" + StringUtilities::toString<int>(pCheckpoint->getPopulationSize())
+					  + "] doesn't match the population size [" + StringUtilities::toString<int>(pGA->populationSize()) + "]");
+		return 1;
+	}
+	gaSeed = pCheckpoint->getSeed();
+
+	// Restore the population and its scores, so it is not evaluated again
+	GAPopulation pop(pGA->population());
+	pop.initializer(GARCheckpoint::PopulationInitializer);
+	pop.userData(pCheckpoint.get());
+	pGA->population(pop);
+	pGA->initialize(gaSeed);
+
+	// Restore the generation, the convergence history and the best individuals ever found,
+	// so the termination and the final solution take the generations already evolved into account
+	if (pCheckpoint->restoreStatistics(*pGA) > 0) {
+		return 1;
+	}
+
+	// Go on from the random state the interrupted run took at the checkpoint generation
+	GARandomSeed(GARCheckpoint::deriveSeed(gaSeed, pCheckpoint->getGeneration()));
+
+	return 0;
+}
+
+
+//................................................. Checkpoint a genetic algorithm ...
+int GARouter::checkpointGA(const GAGeneticAlgorithm const* pGA, GARCheckpoint::Approach approach) {
+	int interval = options.isSet("checkpoint-interval") ? options.getInt("checkpoint-interval") : 0;
+	if (interval <= 0) {
+		return 0;
+	}
+
+	uint32_t generation = pGA->generation();
+	if (generation % interval != 0) {
+		return 0;
+	}
+
+	GARCheckpoint checkpoint(logger);
+	if (checkpoint.capture(*pGA, approach, generation, gaSeed) > 0) {
+		return 1;
+	}
+	if (approach == GARCheckpoint::DYNAMIC && checkpoint.captureStaticSolution(*pStaticSolution) > 0) {
+		return 1;
+	}
+
+	// A checkpoint that can't be written doesn't stop the evolution
+	if (checkpoint.save(options.getString("checkpoint-file")) == 0 && logger->isDebugEnabled()) {
+		logger->debug("Checkpoint written at generation [" + StringUtilities::toString<uint32_t>(generation) + "]");
+	}
+
+	// Reseed at every checkpoint generation, as a run resumed from this checkpoint does,
+	// so the resumed run follows the same trajectory as this one
+	GARandomSeed(GARCheckpoint::deriveSeed(gaSeed, generation));
+
+	return 0;
+}
+
+
+//................................................. Publish the best solution so far ...
+void GARouter::publishIncumbent(const GAGeneticAlgorithm const* pGA, GARCheckpoint::Approach approach, bool force) {
+	string option = (approach == GARCheckpoint::STATIC) ? "incumbent-routes-output" : "incumbent-emitters-output";
+	if (!options.isSet(option)) {
+		return;
+	}
+
+	double interval = options.isSet("incumbent-interval") ? options.getFloat("incumbent-interval") : 0.0;
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (!force && std::chrono::duration<double>(now - incumbentTime).count() < interval) {
+		return;
+	}
+
+	// The generation left unevaluated at the deadline holds no solution of its own
+	if (!GARPopulationEvaluator::isAnyScored() || (!force && !GARPopulationEvaluator::isLastScored())) {
+		if (force) {
+			logger->warning("No individual was evaluated before the deadline, no solution to publish");
+		}
+		return;
+	}
+	incumbentTime = now;
+
+	string path = options.getString(option);
+	string tmpPath = path + ".tmp";
+	const GAGenome& best = pGA->statistics().bestIndividual();
+	int status = 0;
+
+	if (approach == GARCheckpoint::STATIC) {
+		// Every route taken by the solution with the number of trips it carries
+		vector<uint32_t> routes = decodeStaticSolution(best);
+		std::sort(routes.begin(), routes.end());
+		ofstream out(tmpPath, std::ios::trunc);
+		for (size_t i = 0; i < routes.size(); ) {
+			size_t j = i;
+			while (j < routes.size() && routes[j] == routes[i]) {
+				j++;
+			}
+			out << pStaticObjData->getRouteDesc(routes[i]).routename << ' ' << (j - i) << std::endl;
+			i = j;
+		}
+		out.close();
+		status = out ? 0 : 1;
+	} else {
+		status = GARDynObjective::writeEmitterFile(tmpPath,
+												   pDynObjData->getBegin(),
+												   pDynObjData->getEnd(),
+												   pDynObjData->getTimeStep(),
+												   pDynObjData->getpDetCont(),
+												   pDynObjData->getpDetFlows(),
+												   pDynObjData->getpRouCont(),
+												   pDynObjData->getRoutesSolution(),
+												   (const genome_dyn&)best);
+	}
+
+	// A solution that can't be published doesn't stop the evolution
+	if (status > 0 || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+		logger->warning("Unable to publish the best solution so far to [" + path + "]");
+		return;
+	}
+
+	if (logger->isDebugEnabled()) {
+		logger->debug("Published the best solution so far, score [" + StringUtilities::toString<float>(best.score())
+					  + "], to [" + path + "]");
+	}
+}
+
+
 //................................................. Build the data required in the objective function ...
 int GARouter::buildGADynObjectiveData(void) {
 	// Set the input files to feed the SUMO simulation
@@ -657,7 +1105,7 @@ int GARouter::buildGADynObjectiveData(void) {
 
 	// Set the solution of the static approach
 	if (pStaticSolution != nullptr) {
-		pDynObjData->setRoutesSolution(*pStaticSolution);
+		pDynObjData->setRoutesSolution(getStaticSolutionRoutes());
 	} else {
 		logger->error("The static solution is not computed.");
 		return 1;
@@ -671,6 +1119,127 @@ int GARouter::buildGADynObjectiveData(void) {
 	}
 	logger->info("Induction loop file [" + pDynObjData->getLoopFile() + "] successfully written");
 
+	// Index the induction loop measurements by detector and time step
+	pLoopReader = std::unique_ptr<GARLoopMeasReader>(new GARLoopMeasReader(pDynObjData->getLoops2Detectors(),
+																		   pDynObjData->getBegin(),
+																		   pDynObjData->getEnd(),
+																		   pDynObjData->getTimeStep()));
+	pDynObjData->setpLoopReader(pLoopReader.get());
+
+	// Set the SUMO executable
+	if (options.isSet("sumo-binary")) {
+		logger->info("Set SUMO executable [" + options.getString("sumo-binary") + "] to objective data");
+		pDynObjData->setSumoBinary(options.getString("sumo-binary"));
+	}
+
+	// Cache the scores of the genomes already simulated
+	if (options.isSet("fitness-cache") && options.getInt("fitness-cache") > 0) {
+		logger->info("Set a score cache of [" + StringUtilities::toString<int>(options.getInt("fitness-cache")) + "] genomes to objective data");
+		pDynCache = std::unique_ptr<GARFitnessCache>(new GARFitnessCache(options.getInt("fitness-cache")));
+		pDynObjData->setpFitnessCache(pDynCache.get());
+	}
+
+	// Evaluate the genomes with the in-process mesoscopic simulator
+	string evaluator = options.isSet("dyn-evaluator") ? StringUtilities::trim(options.getString("dyn-evaluator")) : "sumo";
+	if (evaluator == "meso") {
+		logger->info("Set the mesoscopic simulator to objective data");
+		pMesoSim = std::unique_ptr<GARMesoSim>(new GARMesoSim(pRouCont.get(),
+															  pDetCont.get(),
+															  pDynObjData->getBegin(),
+															  pDynObjData->getEnd(),
+															  pDynObjData->getTimeStep()));
+		if (options.isSet("meso-headway")) {
+			pMesoSim->setHeadway(options.getFloat("meso-headway"));
+		}
+		pDynObjData->setpMesoSim(pMesoSim.get());
+	} else if (evaluator == "sumo") {
+		// Create a private sandbox per SUMO worker
+		int numWorkers = options.isSet("sumo-workers") ? options.getInt("sumo-workers") : 1;
+		if (numWorkers > 1) {
+			pWorkerPool = std::unique_ptr<GARSumoWorkerPool>(new GARSumoWorkerPool(logger));
+			if (pWorkerPool->createSandboxes(numWorkers, pDynObjData->getLoopFile()) > 0) {
+				return 1;
+			}
+			pDynObjData->setpWorkerPool(pWorkerPool.get());
+		}
+	} else {
+		logger->error("Unknown dynamic evaluator [" + evaluator + "]");
+		return 1;
+	}
+
+	// Persist the simulated detector flows across runs
+	if (options.isSet("sim-store") && !StringUtilities::trim(options.getString("sim-store")).empty()) {
+		string path = StringUtilities::trim(options.getString("sim-store"));
+		logger->info("Set the simulation result store [" + path + "] to objective data");
+
+		common::Hash128 fingerprint;
+		if (computeSimFingerprint(evaluator, fingerprint) > 0) {
+			return 1;
+		}
+
+		vector<string> detectorIds;
+		for (const GARDetector const* pDet : pDetCont->getDetectors()) {
+			detectorIds.push_back(pDet->getID());
+		}
+
+		pSimStore = std::unique_ptr<GARSimResultStore>(new GARSimResultStore(logger));
+		if (pSimStore->open(path,
+							fingerprint,
+							detectorIds,
+							pDynObjData->getBegin(),
+							pDynObjData->getEnd(),
+							pDynObjData->getTimeStep()) > 0) {
+			return 1;
+		}
+		logger->info("Simulation result store [" + path + "] holds [" + StringUtilities::toString<size_t>(pSimStore->size()) + "] records");
+		pDynObjData->setpSimStore(pSimStore.get());
+	}
+
+	return 0;
+}
+
+
+//................................................. Compute the fingerprint of the simulated scenario ...
+int GARouter::computeSimFingerprint(const string& evaluator, common::Hash128& fingerprint) const {
+	// The simulation input files
+	const string files[] = { pDynObjData->getNetFile(), pDynObjData->getRouFile(), pDynObjData->getLoopFile() };
+	fingerprint = common::HashUtilities::hash128(nullptr, 0);
+	for (const string& file : files) {
+		common::Hash128 hash;
+		if (!common::HashUtilities::hashFile(file, hash)) {
+			logger->error("Unable to read [" + file + "] to fingerprint the simulation results");
+			return 1;
+		}
+		fingerprint = common::HashUtilities::combine(fingerprint, hash);
+	}
+
+	// The routes of the vehicles, in gene order
+	std::ostringstream scenario;
+	for (const string& route : pDynObjData->getRoutesSolution()) {
+		scenario << route << '\n';
+	}
+
+	// The goal flows, which set the emitter depart speeds
+	for (const auto& det : pFlows->getFlows()) {
+		scenario << det.first;
+		for (const FlowDef& fd : det.second) {
+			scenario << ' ' << fd.qPKW << ' ' << fd.qLKW << ' ' << fd.vPKW << ' ' << fd.vLKW;
+		}
+		scenario << '\n';
+	}
+
+	// The simulator settings
+	scenario << pDynObjData->getBegin() << ' ' << pDynObjData->getEnd() << ' '
+			 << pDynObjData->getTimeStep() << ' ' << pDynObjData->getTimeToTeleport() << ' ' << evaluator << ' ';
+	if (evaluator == "meso") {
+		scenario << (options.isSet("meso-headway") ? options.getFloat("meso-headway") : 0.0);
+	} else {
+		scenario << pDynObjData->getSumoBinary();
+	}
+
+	string text = scenario.str();
+	fingerprint = common::HashUtilities::combine(fingerprint, common::HashUtilities::hash128(text.data(), text.size()));
+
 	return 0;
 }
 
@@ -774,6 +1343,15 @@ int GARouter::buildGADynGeneticAlgorithm(void) {
 		}
 	}
 
+	// Set the islands and the migration scheme for island GA
+	if (gaType == "Island") {
+		logger->info(">> Set the Island Model");
+		result = setGAIslandModel(pGADyn.get());
+		if (result > 0) {
+			return result;
+		}
+	}
+
 	return 0;
 }
 
@@ -803,24 +1381,30 @@ int GARouter::evolveDynGA(void) {
 		string scoreFile = buildScoreFileName("dyn_");
 		pGADyn->scoreFilename(scoreFile.c_str());
 
+		// Start the clock of the time budget
+		if (pTerminator != nullptr) {
+			pTerminator->start();
+		}
+		incumbentTime = std::chrono::steady_clock::now();
+
 		// Initialize the dynamic genetic algorithm using a seed if reported
 		logger->info("Initializing the dynamic GA for the static approach...");
-		if (options.isSet("ga-seed")) {
-			pGADyn->initialize(options.getInt("ga-seed"));
-		} else {
-			pGADyn->initialize();
+		if (initializeGA(pGADyn.get(), GARCheckpoint::DYNAMIC) > 0) {
+			return 1;
 		}
 
 		// Print the initial population
-		logger->debug("Initial population:");
-		for (int i = 0; i < pGADyn->populationSize(); i++) {
-			string sGenome = "";
-			const genome_dyn& genome = (genome_dyn&)pGADyn->population().individual(i);
-
-			for (int j = 0; j < genome.size(); j++) {
-				sGenome += StringUtilities::toString<int>(genome.gene(j)) + " ";
+		if (logger->isDebugEnabled()) {
+			logger->debug("Initial population:");
+			for (int i = 0; i < pGADyn->populationSize(); i++) {
+				string sGenome = "";
+				const genome_dyn& genome = (genome_dyn&)pGADyn->population().individual(i);
+
+				for (int j = 0; j < genome.size(); j++) {
+					sGenome += StringUtilities::toString<int>(genome.gene(j)) + " ";
+				}
+				logger->debug("Genome " + StringUtilities::toString<int>(i) + ": " + sGenome);
 			}
-			logger->debug("Genome " + StringUtilities::toString<int>(i) + ": " + sGenome);
 		}
 
 		// Evolve the dynamic genetic algorithm
@@ -830,6 +1414,10 @@ int GARouter::evolveDynGA(void) {
 		std::cout.flush();
 		while (!pGADyn->done()) {
 			pGADyn->step();
+			if (checkpointGA(pGADyn.get(), GARCheckpoint::DYNAMIC) > 0) {
+				return 1;
+			}
+			publishIncumbent(pGADyn.get(), GARCheckpoint::DYNAMIC, false);
 			std::cout << ".";
 			if (pGADyn->generation() % 10 == 0) {
 				std::cout << pGADyn->generation() << std::endl;
@@ -839,9 +1427,35 @@ int GARouter::evolveDynGA(void) {
 		std::cout << std::endl;
 		logger->info("Evolution done");
 
+		// Wait for the evaluations still in flight
+		stopGAWorkers(pGADyn.get());
+
+		// Publish the final solution, and why the evolution stopped before the last generation
+		publishIncumbent(pGADyn.get(), GARCheckpoint::DYNAMIC, true);
+		if (pTerminator != nullptr && !pTerminator->getReason().empty()) {
+			logger->info("Evolution stopped at generation [" + StringUtilities::toString<int>(pGADyn->generation())
+						 + "]: " + pTerminator->getReason());
+		}
+
+		// Report the score cache and simulation result store usage
+		reportFitnessCache(pDynCache.get());
+		reportSimStore(pSimStore.get());
+
 		// Get the best solution
 		const genome_dyn& best = (genome_dyn&) pGADyn->statistics().bestIndividual();
 
+		// Validate the best solution of the mesoscopic simulator with a SUMO simulation
+		if (pMesoSim != nullptr && options.isSet("sumo-validation") && options.getBool("sumo-validation")) {
+			logger->info("Validating the best dynamic solution with a SUMO simulation...");
+			float score = GARDynObjective::evaluate(best,
+													pDynObjData.get(),
+													pDynObjData->getLoopFile(),
+													pDynObjData->getEmitFile(),
+													"");
+			logger->info("Best dynamic solution score: mesoscopic [" + StringUtilities::toString<float>(best.score()) +
+						 "], SUMO [" + StringUtilities::toString<float>(score) + "]");
+		}
+
 	} catch (const std::exception& ex) {
 		logger->error("Fail to evolve the genetic algorithm: " + string(ex.what()) );
 		return 1;
@@ -851,6 +1465,55 @@ int GARouter::evolveDynGA(void) {
 }
 
 
+//................................................. Stop the asynchronous evaluations ...
+void GARouter::stopGAWorkers(GAGeneticAlgorithm* pGA) const {
+	GARAsyncGA* pAsyncGA = dynamic_cast<GARAsyncGA*>(pGA);
+	if (pAsyncGA == nullptr) {
+		return;
+	}
+
+	double utilization = 100.0 * pAsyncGA->utilization();
+	pAsyncGA->stop();
+
+	string report = "Evaluation workers: [" + StringUtilities::toString<unsigned int>(pAsyncGA->numThreads()) + "] threads, ["
+					+ StringUtilities::toString<double>(utilization) + "%] utilization";
+	logger->info(report);
+	std::cout << report << std::endl;
+}
+
+
+//................................................. Report the score cache usage ...
+void GARouter::reportFitnessCache(const GARFitnessCache const* pCache) const {
+	if (pCache == nullptr) {
+		return;
+	}
+
+	uint64_t hits = pCache->getHits();
+	uint64_t misses = pCache->getMisses();
+	double hitRate = (hits + misses > 0) ? 100.0 * hits / double(hits + misses) : 0.0;
+
+	string report = "Score cache: [" + StringUtilities::toString<uint64_t>(hits) + "] hits, ["
+					+ StringUtilities::toString<uint64_t>(misses) + "] misses ("
+					+ StringUtilities::toString<double>(hitRate) + "% hit rate)";
+	logger->info(report);
+	std::cout << report << std::endl;
+}
+
+
+//................................................. Report the simulation result store usage ...
+void GARouter::reportSimStore(GARSimResultStore* pStore) const {
+	if (pStore == nullptr) {
+		return;
+	}
+
+	string report = "Simulation result store: [" + StringUtilities::toString<uint64_t>(pStore->getHits()) + "] hits, ["
+					+ StringUtilities::toString<uint64_t>(pStore->getMisses()) + "] misses, ["
+					+ StringUtilities::toString<size_t>(pStore->size()) + "] records";
+	logger->info(report);
+	std::cout << report << std::endl;
+}
+
+
 //................................................. Set the initialization operator ...
 void GARouter::setGAGenomeInitializer(GAGenome* pGenome) {
 	string initializer = options.getString("genome-initializer");
@@ -860,7 +1523,10 @@ void GARouter::setGAGenomeInitializer(GAGenome* pGenome) {
 	try {
 		if (StringUtilities::trim(initializer) == "Uniform") {
 			if (typeid(*pGenome) == typeid(genome_static)) {
-				static_cast<genome_static*>(pGenome)->initializer(genome_static::UniformInitializer);
+				static_cast<genome_static*>(pGenome)->initializer(GARStaticObjective::uniformInitializer<genome_static>);
+			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->initializer(GARStaticObjective::uniformInitializer<genome_static_wide>);
 			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->initializer(genome_dyn::UniformInitializer);
@@ -870,7 +1536,10 @@ void GARouter::setGAGenomeInitializer(GAGenome* pGenome) {
 
 		if (StringUtilities::trim(initializer) == "Ordered") {
 			if (typeid(*pGenome) == typeid(genome_static)) {
-				static_cast<genome_static*>(pGenome)->initializer(genome_static::OrderedInitializer);
+				static_cast<genome_static*>(pGenome)->initializer(GARStaticObjective::orderedInitializer<genome_static>);
+			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->initializer(GARStaticObjective::orderedInitializer<genome_static_wide>);
 			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->initializer(genome_dyn::OrderedInitializer);
@@ -882,6 +1551,9 @@ void GARouter::setGAGenomeInitializer(GAGenome* pGenome) {
 		if (typeid(*pGenome) == typeid(genome_static)) {
 			static_cast<genome_static*>(pGenome)->initializer(genome_static::NoInitializer);
 		}
+		if (typeid(*pGenome) == typeid(genome_static_wide)) {
+			static_cast<genome_static_wide*>(pGenome)->initializer(genome_static_wide::NoInitializer);
+		}
 		if (typeid(*pGenome) == typeid(genome_dyn)) {
 			static_cast<genome_dyn*>(pGenome)->initializer(genome_dyn::NoInitializer);
 		}
@@ -901,7 +1573,10 @@ void GARouter::setGAGenomeMutator(GAGenome* pGenome) {
 	try {
 		if (StringUtilities::trim(mutator) == "Flip") {
 			if (typeid(*pGenome) == typeid(genome_static)) {
-				static_cast<genome_static*>(pGenome)->mutator(genome_static::FlipMutator);
+				static_cast<genome_static*>(pGenome)->mutator(GARStaticObjective::flipMutator<genome_static>);
+			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->mutator(GARStaticObjective::flipMutator<genome_static_wide>);
 			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->mutator(genome_dyn::FlipMutator);
@@ -911,7 +1586,10 @@ void GARouter::setGAGenomeMutator(GAGenome* pGenome) {
 
 		if (StringUtilities::trim(mutator) == "Swap") {
 			if (typeid(*pGenome) == typeid(genome_static)) {
-				static_cast<genome_static*>(pGenome)->mutator(genome_static::SwapMutator);
+				static_cast<genome_static*>(pGenome)->mutator(GARStaticObjective::swapMutator<genome_static>);
+			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->mutator(GARStaticObjective::swapMutator<genome_static_wide>);
 			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->mutator(genome_dyn::SwapMutator);
@@ -919,10 +1597,28 @@ void GARouter::setGAGenomeMutator(GAGenome* pGenome) {
 			return;
 		}
 
+		if (StringUtilities::trim(mutator) == "Residual") {
+			if (typeid(*pGenome) == typeid(genome_static)) {
+				static_cast<genome_static*>(pGenome)->mutator(GARStaticObjective::residualMutator<genome_static>);
+			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->mutator(GARStaticObjective::residualMutator<genome_static_wide>);
+			}
+			if (typeid(*pGenome) == typeid(genome_dyn)) {
+				// The depart times have no edge flow residuals to follow
+				logger->warning("The Residual mutation operator only applies to the static approach, use Flip instead");
+				static_cast<genome_dyn*>(pGenome)->mutator(genome_dyn::FlipMutator);
+			}
+			return;
+		}
+
 		logger->error("Unknown mutation operator [" + mutator + "]");
 		if (typeid(*pGenome) == typeid(genome_static)) {
 			static_cast<genome_static*>(pGenome)->mutator(genome_static::NoMutator);
 		}
+		if (typeid(*pGenome) == typeid(genome_static_wide)) {
+			static_cast<genome_static_wide*>(pGenome)->mutator(genome_static_wide::NoMutator);
+		}
 		if (typeid(*pGenome) == typeid(genome_dyn)) {
 			static_cast<genome_dyn*>(pGenome)->mutator(genome_dyn::NoMutator);
 		}
@@ -944,6 +1640,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::CycleCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::CycleCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::CycleCrossover);
 			}
@@ -954,6 +1653,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::EvenOddCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::EvenOddCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::EvenOddCrossover);
 			}
@@ -964,6 +1666,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::OnePointCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::OnePointCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::OnePointCrossover);
 			}
@@ -974,6 +1679,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::OrderCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::OrderCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::OrderCrossover);
 			}
@@ -984,6 +1692,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::PartialMatchCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::PartialMatchCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::PartialMatchCrossover);
 			}
@@ -994,6 +1705,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::TwoPointCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::TwoPointCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::TwoPointCrossover);
 			}
@@ -1004,6 +1718,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 			if (typeid(*pGenome) == typeid(genome_static)) {
 				static_cast<genome_static*>(pGenome)->crossover(genome_static::UniformCrossover);
 			}
+			if (typeid(*pGenome) == typeid(genome_static_wide)) {
+				static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::UniformCrossover);
+			}
 			if (typeid(*pGenome) == typeid(genome_dyn)) {
 				static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::UniformCrossover);
 			}
@@ -1014,6 +1731,9 @@ void GARouter::setGAGenomeCrossover(GAGenome* pGenome) {
 		if (typeid(*pGenome) == typeid(genome_static)) {
 			static_cast<genome_static*>(pGenome)->crossover(genome_static::OnePointCrossover);
 		}
+		if (typeid(*pGenome) == typeid(genome_static_wide)) {
+			static_cast<genome_static_wide*>(pGenome)->crossover(genome_static_wide::OnePointCrossover);
+		}
 		if (typeid(*pGenome) == typeid(genome_dyn)) {
 			static_cast<genome_dyn*>(pGenome)->crossover(genome_dyn::OnePointCrossover);
 		}
@@ -1116,6 +1836,27 @@ int GARouter::setGATerminationFunction(GAGeneticAlgorithm* pGA) {
 		return 0;
 	}
 
+	if (StringUtilities::trim(termination) == "UponBudget") {
+		// The static and dynamic approaches share the same deadline
+		if (pTerminator == nullptr) {
+			double timeBudget = options.isSet("time-budget") ? options.getFloat("time-budget") : 0.0;
+			int stallGenerations = options.isSet("stall-generations") ? options.getInt("stall-generations") : 0;
+			float minImprovement = options.isSet("min-improvement") ? options.getFloat("min-improvement") : 0.0;
+			if (timeBudget < 0.0 || stallGenerations < 0) {
+				logger->error("Invalid time budget [" + StringUtilities::toString<double>(timeBudget)
+							  + "] or stall generations [" + StringUtilities::toString<int>(stallGenerations) + "]");
+				return 1;
+			}
+			pTerminator = std::unique_ptr<GARBudgetTerminator>(new GARBudgetTerminator(timeBudget, stallGenerations, minImprovement));
+		}
+		pGA->userData(pTerminator.get());
+		pGA->terminator(GARBudgetTerminator::TerminateUponBudget);
+
+		// The population evaluator stops evaluating at the deadline too
+		GARPopulationEvaluator::setTerminator(pTerminator.get());
+		return 0;
+	}
+
 	logger->warning("Unknown termination function [" + termination + "].");
 	return 1;
 }
@@ -1124,7 +1865,7 @@ int GARouter::setGATerminationFunction(GAGeneticAlgorithm* pGA) {
 //................................................. Set the replacement scheme ...
 int GARouter::setGAReplacementScheme(GAGeneticAlgorithm* pGA) {
 	// The replacement scheme only concerns to incremental GA
-	if (typeid(*pGA) != typeid(GAIncrementalGA)) {
+	if (dynamic_cast<GAIncrementalGA*>(pGA) == nullptr) {
 		logger->warning("Replacement scheme can't be applied to a non-Incremental GA.");
 		return 0;
 	}
@@ -1137,42 +1878,42 @@ int GARouter::setGAReplacementScheme(GAGeneticAlgorithm* pGA) {
 	string replacement = options.getString("replacement-scheme");
 
 	if (StringUtilities::trim(replacement) == "Random") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::RANDOM);
 		}
 		return 0;
 	}
 
 	if (StringUtilities::trim(replacement) == "Best") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::BEST);
 		}
 		return 0;
 	}
 
 	if (StringUtilities::trim(replacement) == "Worst") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::WORST);
 		}
 		return 0;
 	}
 
 	if (StringUtilities::trim(replacement) == "Custom") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::CUSTOM);
 		}
 		return 0;
 	}
 
 	if (StringUtilities::trim(replacement) == "Crowding") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::CROWDING);
 		}
 		return 0;
 	}
 
 	if (StringUtilities::trim(replacement) == "Parent") {
-		if (typeid(*pGA) == typeid(GAIncrementalGA)) {
+		if (dynamic_cast<GAIncrementalGA*>(pGA) != nullptr) {
 			dynamic_cast<GAIncrementalGA*>(pGA)->replacement(GAIncrementalGA::PARENT);
 		}
 		return 0;
@@ -1183,6 +1924,88 @@ int GARouter::setGAReplacementScheme(GAGeneticAlgorithm* pGA) {
 }
 
 
+//................................................. Set the island model ...
+int GARouter::setGAIslandModel(GAGeneticAlgorithm* pGA) {
+	GARIslandGA* pIslandGA = dynamic_cast<GARIslandGA*>(pGA);
+	if (pIslandGA == nullptr) {
+		return 0;
+	}
+
+	int numIslands = options.getInt("number-of-populations");
+	if (numIslands < 1) {
+		logger->error("Invalid number of islands [" + StringUtilities::toString<int>(numIslands) + "] in 'number-of-populations' option");
+		return 1;
+	}
+	logger->info("Set [" + StringUtilities::toString<int>(numIslands) + "] islands");
+	pIslandGA->nIslands(numIslands);
+
+	// Every island steps on a thread of its own unless the evaluator limits them
+	pIslandGA->numThreads(numIslands);
+
+	if (options.isSet("migration-interval")) {
+		pIslandGA->migrationInterval(options.getInt("migration-interval"));
+	}
+	if (options.isSet("migration-number")) {
+		pIslandGA->migrationNumber(options.getInt("migration-number"));
+	}
+
+	string topology = options.isSet("migration-topology") ? StringUtilities::trim(options.getString("migration-topology")) : "Ring";
+	if (topology == "Ring") {
+		pIslandGA->topology(GARIslandGA::RING);
+	} else if (topology == "Random") {
+		pIslandGA->topology(GARIslandGA::RANDOM);
+	} else {
+		logger->error("Unknown migration topology [" + topology + "] in 'migration-topology' option");
+		return 1;
+	}
+	logger->info("Migrate [" + StringUtilities::toString<int>(pIslandGA->migrationNumber()) + "] individuals every ["
+				 + StringUtilities::toString<int>(pIslandGA->migrationInterval()) + "] generations in a [" + topology + "] topology");
+
+	return 0;
+}
+
+
+//................................................. Set the population evaluator ...
+int GARouter::setGAPopulationEvaluator(GAGeneticAlgorithm* pGA, int numThreads) {
+	try {
+		if (numThreads < 1) {
+			logger->error("Invalid number of evaluation threads [" + StringUtilities::toString<int>(numThreads) + "]");
+			return 1;
+		}
+
+		// The islands evaluate their own populations, so the threads step the islands
+		GARIslandGA* pIslandGA = dynamic_cast<GARIslandGA*>(pGA);
+		if (pIslandGA != nullptr) {
+			logger->info("Step up to [" + StringUtilities::toString<int>(numThreads) + "] islands concurrently");
+			pIslandGA->numThreads(numThreads);
+			return 0;
+		}
+
+		// The asynchronous algorithm keeps an evaluation in flight per thread
+		GARAsyncGA* pAsyncGA = dynamic_cast<GARAsyncGA*>(pGA);
+		if (pAsyncGA != nullptr) {
+			logger->info("Keep [" + StringUtilities::toString<int>(numThreads) + "] evaluations in flight");
+			pAsyncGA->numThreads(numThreads);
+			return 0;
+		}
+
+		logger->info("Set the population evaluator with [" + StringUtilities::toString<int>(numThreads) + "] threads");
+		GARPopulationEvaluator::setNumThreads(numThreads);
+
+		// The algorithm copies the population to its internal populations
+		GAPopulation pop(pGA->population());
+		pop.evaluator(GARPopulationEvaluator::evaluate);
+		pGA->population(pop);
+
+	} catch (const std::exception& ex) {
+		logger->error("Fail to set the population evaluator: " + string(ex.what()));
+		return 1;
+	}
+
+	return 0;
+}
+
+
 //................................................. Set the genetic algorithm parameters ...
 int GARouter::setGAParameters(void) {
 	try {
@@ -1283,6 +2106,33 @@ int GARouter::setGAParameters(void) {
 			params.set(gaNnMigration, migrationNum);
 		}
 
+		// Evaluate the dynamic population on the SUMO workers, or the static population on the evaluation threads
+		if (pGADyn != nullptr) {
+			int numWorkers = (pWorkerPool != nullptr) ? pWorkerPool->size() : 1;
+			if (pMesoSim != nullptr && options.isSet("evaluation-threads")) {
+				numWorkers = options.getInt("evaluation-threads");
+			}
+			int result = setGAPopulationEvaluator(pGADyn.get(), numWorkers);
+			if (result > 0) {
+				return result;
+			}
+		} else if (pGAStatic != nullptr && typeid(*pGAStatic) == typeid(GARIslandGA)) {
+			// The static objective is thread-safe, so every island keeps a thread of its own
+			if (options.isSet("evaluation-threads") && options.getInt("evaluation-threads") > 1) {
+				int result = setGAPopulationEvaluator(pGAStatic.get(), options.getInt("evaluation-threads"));
+				if (result > 0) {
+					return result;
+				}
+			}
+		} else if (pGAStatic != nullptr && (options.isSet("evaluation-threads") || pTerminator != nullptr)) {
+			// The budget needs the population evaluator to check the deadline, even on a single thread
+			int numThreads = options.isSet("evaluation-threads") ? options.getInt("evaluation-threads") : 1;
+			int result = setGAPopulationEvaluator(pGAStatic.get(), numThreads);
+			if (result > 0) {
+				return result;
+			}
+		}
+
 	} catch (const std::exception& ex) {
 		logger->error("Fail to set the genetic algorithms parameters: " + string(ex.what()));
 		return 1;
@@ -1331,15 +2181,12 @@ void GARouter::logTrips(void) const {
 
 
 //................................................. Build the network graph used by the k-shortest-path algorithm ...
-Graph GARouter::buildKShortestGraph(void) const {
-	Graph graph;
-	const int numNodes = pNet->getNodeList().size();
-
-	graph.set_number_vertices(numNodes);
+GARKShortestGraph GARouter::buildKShortestGraph(void) const {
+	GARKShortestGraph kGraph;
+	vector<CSRLink> links;
 
 	// Get the network edges
 	for (auto edge : pNet->getEdgeMap()) {
-		string edgeId = edge.first;
 		const ROEdge const* pEdge = edge.second;
 
 		// Refuse internal edges
@@ -1347,28 +2194,32 @@ Graph GARouter::buildKShortestGraph(void) const {
 			continue;
 		}
 
-		// Get the from and to nodes and the duration of the edge
-		std::string fromNodeId = pEdge->getFromNode()->getID();
-		std::string toNodeId = pEdge->getToNode()->getID();
+		// Get the from and to vertices and the duration of the edge
+		auto from = kGraph.nodeIndices.insert(std::make_pair(pEdge->getFromNode()->getID(), uint32_t(kGraph.nodeIndices.size()))).first;
+		auto to = kGraph.nodeIndices.insert(std::make_pair(pEdge->getToNode()->getID(), uint32_t(kGraph.nodeIndices.size()))).first;
 		double duration = pEdge->getLength() / pEdge->getSpeed();
 
 		// Add the link to the graph
-		graph.add_link(fromNodeId, toNodeId, duration);
+		CSRLink link;
+		link.u = from->second;
+		link.v = to->second;
+		link.weight = duration;
+		links.push_back(link);
+		kGraph.edges.push_back(pEdge);
 	}
 
-	// Set the number of vertices and edges
-	graph.setv();
+	kGraph.graph = CSRGraph(kGraph.nodeIndices.size(), links);
 
-	return graph;
+	return kGraph;
 }
 
 
 //................................................. Get the shortest paths ...
-std::vector<GARRouteDesc> GARouter::getKShortestRoutes(const Graph& graph,
+std::vector<GARRouteDesc> GARouter::getKShortestRoutes(const GARKShortestGraph& kGraph,
+													   CSRYenKShortestPathsAlg& shortestPaths,
 												       const GARDetector const* pSourceDet,
 													   const GARDetector const* pSinkDet,
-													   int k,
-													   int kSelected) const {
+													   int k) const {
 	vector<GARRouteDesc> kShortestRoutes;
 
 	string sourceEdgeId = pSourceDet->getEdgeID();
@@ -1381,22 +2232,23 @@ std::vector<GARRouteDesc> GARouter::getKShortestRoutes(const Graph& graph,
 	string fromNode = pSourceEdge->getFromNode()->getID();
 	string toNode = pSinkEdge->getToNode()->getID();
 
-	//Get the K-shortest routes from the origin to the destination nodes
-	logger->debug("Shortest paths from [" + fromNode + "] to [" + toNode + "]");
-	YenTopKShortestPathsAlg shortestPaths (graph,
-										   graph.get_vertex(fromNode),
-										   graph.get_vertex(toNode));
+	auto from = kGraph.nodeIndices.find(fromNode);
+	auto to = kGraph.nodeIndices.find(toNode);
+	if (from == kGraph.nodeIndices.end() || to == kGraph.nodeIndices.end()) {
+		return kShortestRoutes;
+	}
 
-	for (int i = 0; i < k  &&  shortestPaths.has_next(); i++) {
-		BasePath* path = shortestPaths.next();
-		logger->debug("\tPath " + StringUtilities::toString<int>(i) + ": [" + path->toString() + "]");
+	//Get the K-shortest routes from the origin to the destination nodes
+	vector<CSRPath> paths;
+	shortestPaths.get_shortest_paths(from->second, to->second, k, paths);
 
+	for (size_t i = 0; i < paths.size(); i++) {
 		//Build the route description
-		GARRouteDesc rd = buildKShortestRouteDesc(path, sourceEdgeId, sinkEdgeId, i);
+		GARRouteDesc rd = buildKShortestRouteDesc(kGraph, paths[i], sourceEdgeId, sinkEdgeId, (int)i);
 		kShortestRoutes.push_back(rd);
 	}
 
-	return getSelectedRoutes(kShortestRoutes, kSelected);
+	return kShortestRoutes;
 }
 
 
@@ -1448,14 +2300,15 @@ int GARouter::addKShortestRoutes(const std::vector<GARRouteDesc>& kShortestRoute
 
 
 //................................................. Build the shortest route description ...
-GARRouteDesc GARouter::buildKShortestRouteDesc(const BasePath const* path,
+GARRouteDesc GARouter::buildKShortestRouteDesc(const GARKShortestGraph& kGraph,
+											   const CSRPath& path,
 		  	  	  	  	  	  	  	  	  	   const std::string& sourceEdgeId,
 											   const std::string& sinkEdgeId,
 											   int routeNum) const {
 	GARRouteDesc rd;
 	string suffix = (routeNum > 0) ? ("_" + StringUtilities::toString<int>(routeNum)) : "";
 	rd.routename = sourceEdgeId + "_to_" + sinkEdgeId + suffix;
-	rd.duration_2 = path->Weight();
+	rd.duration_2 = path.Weight();
 	rd.distance = 0;
 	rd.distance2Last = 0;
 	rd.duration2Last = 0;
@@ -1466,10 +2319,8 @@ GARRouteDesc GARouter::buildKShortestRouteDesc(const BasePath const* path,
 	rd.passedNo = 0;
 
 	// Add edges to the route description
-	for (int i = 0; i < path->length()-1; i++) {
-		const BaseVertex* fromVertex = path->GetVertex(i);
-		const BaseVertex* toVertex = path->GetVertex(i+1);
-		const ROEdge const* pEdge = pNet->getpEdge(fromVertex->getID(), toVertex->getID());
+	for (uint32_t edge : path.edges()) {
+		const ROEdge const* pEdge = kGraph.edges[edge];
 
 		rd.edges2Pass.push_back(const_cast<ROEdge*>(pEdge));
 
@@ -1578,10 +2429,12 @@ gar::trip_vector GARouter::getTripsFromTazToTaz(const std::string& fromTaz, cons
 			if (it == pTripCont->getOdTrips().end()) {
 				continue;
 			}
-			logger->debug("Trip from edge [" + (*it)->getpOrig()->getID()
-						+ "] to edge [" + (*it)->getpDest()->getID() + "]");
-			for (auto rd : (*it)->getOdRoutes()) {
-				logger->debug("\tRoute: [" + rd->routename + "]");
+			if (logger->isDebugEnabled()) {
+				logger->debug("Trip from edge [" + (*it)->getpOrig()->getID()
+							+ "] to edge [" + (*it)->getpDest()->getID() + "]");
+				for (auto rd : (*it)->getOdRoutes()) {
+					logger->debug("\tRoute: [" + rd->routename + "]");
+				}
 			}
 			tripVec.push_back(*it);
 		}
@@ -1630,14 +2483,14 @@ int GARouter::getGAStatisticsSelectScores(const std::string selectScores) const
 }
 
 
-//................................................. Builds the static allele set array of the genome ...
-GAAlleleSetArray<const char*> GARouter::buildGAStaticAlleleSetArray(void) {
-	GAAlleleSetArray<const char*> alleleArray;
-
+//................................................. Builds the gene layout of the static genome ...
+int GARouter::buildGAStaticGeneLayout(void) {
 	try {
 		matrix<unsigned int> odMatrix = pOdMatrix->getOdMatrix();
 		vector<string> tazs = pOdMatrix->getTazs();
 
+		pStaticObjData->clearGeneLayout();
+
 		for (int i = 0; i < odMatrix.size1(); i++) {
 			for (int j = 0; j < odMatrix.size2(); j++) {
 				string fromTaz = tazs[i];
@@ -1651,47 +2504,108 @@ GAAlleleSetArray<const char*> GARouter::buildGAStaticAlleleSetArray(void) {
 				logger->debug("Get the trips from TAZ [" + fromTaz + "] to TAZ [" + toTaz + "]");
 				trip_vector trips = getTripsFromTazToTaz(fromTaz, toTaz);
 
-				// Build the allele set
-				logger->debug("Build allele set containing trips from [" + fromTaz + "] to [" + toTaz + "]");
-				GAAlleleSet<const char*> alleleSet = buildGAStaticAlleleSet(trips);
+				// Get the candidate routes of the OD pair
+				vector<string> routeNames = getStaticCandidateRoutes(trips);
+				if (routeNames.empty()) {
+					logger->warning("No routes from TAZ [" + fromTaz + "] to TAZ [" + toTaz + "]: ["
+									+ StringUtilities::toString<int>(numTrips) + "] trips are discarded");
+					continue;
+				}
 
-				// Add the allele set to the allele set array
-				logger->debug("Add [" + StringUtilities::toString<int>(numTrips) + "] allele sets to the allele array");
-				for (int k = 0; k < numTrips; k++) {
-					alleleArray.add(alleleSet);
+				// Register the candidate routes and the genes of the OD pair in the objective data
+				if (pStaticObjData->addOdGenes(routeNames, numTrips) > 0) {
+					return 1;
 				}
 			}
 		}
 
+		logger->info("Static gene layout: [" + StringUtilities::toString<int>(pStaticObjData->getNumOds()) + "] OD pairs, ["
+					 + StringUtilities::toString<int>(pStaticObjData->getOdRoutes().size()) + "] routes, ["
+					 + StringUtilities::toString<int>(pStaticObjData->getNumGenes()) + "] trips");
+
+	} catch (const std::exception& ex) {
+		logger->error("Fail to build the gene layout for the static approach: " + string(ex.what()));
+		return 1;
+	}
+
+	return 0;
+}
+
+
+//................................................. Builds the static allele set array of the genome ...
+template<class T>
+GAAlleleSetArray<T> GARouter::buildGAStaticAlleleSetArray(void) {
+	GAAlleleSetArray<T> alleleArray;
+
+	try {
+		const vector<uint32_t>& offsets = pStaticObjData->getOdRouteOffsets();
+
+		// The allele sets shared by the genes of the OD pairs with the same number of candidate routes
+		std::unordered_map<uint32_t, GAAlleleSet<T>> alleleSets;
+
+		for (uint32_t od = 0; od < pStaticObjData->getNumOds(); od++) {
+			uint32_t numRoutes = offsets[od + 1] - offsets[od];
+			uint32_t numTrips = pStaticObjData->getOdTrips(od);
+
+			// Get the allele set of the local route indices
+			auto it = alleleSets.find(numRoutes);
+			if (it == alleleSets.end()) {
+				logger->debug("Build allele set for [" + StringUtilities::toString<int>(numRoutes) + "] routes");
+				it = alleleSets.insert(std::make_pair(numRoutes, buildGAStaticAlleleSet<T>(numRoutes))).first;
+			}
+
+			// Add the allele set to the allele set array
+			logger->debug("Add [" + StringUtilities::toString<int>(numTrips) + "] allele sets to the allele array");
+			for (uint32_t k = 0; k < numTrips; k++) {
+				alleleArray.add(it->second);
+			}
+		}
+
 		logger->debug("Allele array size: " + StringUtilities::toString<int>(alleleArray.size()));
 
 	} catch (const std::exception& ex) {
 		logger->error("Fail to build allele set array for the static approach: " + string(ex.what()));
-		return GAAlleleSetArray<const char*>();
+		return GAAlleleSetArray<T>();
 	}
 
 	return alleleArray;
 }
 
 
+//................................................. Gets the candidate routes of an OD pair ...
+vector<string> GARouter::getStaticCandidateRoutes(const trip_vector& trips) {
+	vector<string> routeNames;
+
+	for (std::shared_ptr<const GARTrip> pTrip : trips) {
+		for (std::shared_ptr<const GARRouteDesc> pRou : pTrip->getOdRoutes()) {
+			routeNames.push_back(pRou->routename);
+		}
+	}
+
+	if (logger->isDebugEnabled()) {
+		logger->debug("Routes for the static approach:");
+		for (size_t i = 0; i < routeNames.size(); i++) {
+			logger->debug("\tStatic Allele (" + StringUtilities::toString<int>(i) + "): [" + routeNames[i] + "]");
+		}
+	}
+
+	return routeNames;
+}
+
+
 //................................................. Builds the static allele set describing a gene in the genome ...
-GAAlleleSet<const char*> GARouter::buildGAStaticAlleleSet(const trip_vector& trips) {
-	GAAlleleSet<const char*> alleleSet;
+template<class T>
+GAAlleleSet<T> GARouter::buildGAStaticAlleleSet(uint32_t numRoutes) {
+	GAAlleleSet<T> alleleSet;
 
 	try {
-		for (std::shared_ptr<const GARTrip> pTrip : trips) {
-			for (std::shared_ptr<const GARRouteDesc> pRou : pTrip->getOdRoutes()) {
-				// Add the allele route to the allele set
-				alleleSet.add(pRou->routename.c_str());
-			}
-		}
-		logger->debug("Alleles for the static approach:");
-		for (int i = 0; i < alleleSet.size(); i++) {
-			logger->debug("\tStatic Allele (" + StringUtilities::toString<int>(i) + "): [" + string(alleleSet.allele(i)) + "]");
+		for (uint32_t i = 0; i < numRoutes; i++) {
+			// Add the local route index to the allele set
+			alleleSet.add((T)i);
 		}
 	} catch (const std::exception& ex) {
 		logger->error("Fail to build the allele set for the static approach: " + string(ex.what()));
-		return GAAlleleSet<const char*>();
+		return GAAlleleSet<T>();
 	}
 
 	return alleleSet;
@@ -1723,8 +2637,7 @@ GAAlleleSetArray<int> GARouter::buildGADynAlleleSetArray(void) {
 
 	try {
 		// Read the routes from the static solution.
-		for (int i = 0; i < pStaticSolution->size(); i++) {
-			string routeName = pStaticSolution->gene(i);
+		for (const string& routeName : getStaticSolutionRoutes()) {
 
 			// Get the lower bound of the beginning time from the detector flow data
 			SUMOTime lower = getDynBeginLowerBound(routeName, begin, timeStep);
@@ -1761,9 +2674,11 @@ GAAlleleSet<int> GARouter::buildGADynAlleleSet(const SUMOTime& lower,
 			alleleSet.add(i);
 		}
 
-		logger->debug("Alleles for the dynamic approach:");
-		for (int i = 0; i < alleleSet.size(); i++) {
-			logger->debug("\tDynamic Allele (" + StringUtilities::toString<int>(i) + "): [" + StringUtilities::toString<int>(alleleSet.allele(i)) + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("Alleles for the dynamic approach:");
+			for (int i = 0; i < alleleSet.size(); i++) {
+				logger->debug("\tDynamic Allele (" + StringUtilities::toString<int>(i) + "): [" + StringUtilities::toString<int>(alleleSet.allele(i)) + "]");
+			}
 		}
 	} catch (const std::exception& ex) {
 		logger->error("Fail to build the allele set for the dynamic approach: " + string(ex.what()));
@@ -1792,13 +2707,15 @@ SUMOTime GARouter::getDynBeginLowerBound(const std::string& routeName,
 
 	// Get the lower bound of the beginning time
 	for (FlowDef fd : origFlowDefs) {
-		logger->debug("qPKW: [" + StringUtilities::toString<SUMOReal>(fd.qPKW) + "], "
-				     "vPKW: [" + StringUtilities::toString<SUMOReal>(fd.vPKW) + "], "
-					 "qLKW: [" + StringUtilities::toString<SUMOReal>(fd.qLKW) + "], "
-					 "vLKW: [" + StringUtilities::toString<SUMOReal>(fd.vLKW) + "], "
-					 "isLKW: [" + StringUtilities::toString<SUMOReal>(fd.isLKW) + "], "
-					 "fLKW: [" + StringUtilities::toString<SUMOReal>(fd.fLKW) + "], "
-					 "firstSet: [" + StringUtilities::toString<bool>(fd.firstSet) + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("qPKW: [" + StringUtilities::toString<SUMOReal>(fd.qPKW) + "], "
+					     "vPKW: [" + StringUtilities::toString<SUMOReal>(fd.vPKW) + "], "
+						 "qLKW: [" + StringUtilities::toString<SUMOReal>(fd.qLKW) + "], "
+						 "vLKW: [" + StringUtilities::toString<SUMOReal>(fd.vLKW) + "], "
+						 "isLKW: [" + StringUtilities::toString<SUMOReal>(fd.isLKW) + "], "
+						 "fLKW: [" + StringUtilities::toString<SUMOReal>(fd.fLKW) + "], "
+						 "firstSet: [" + StringUtilities::toString<bool>(fd.firstSet) + "]");
+		}
 		if (fd.qPKW > 0 || fd.qLKW > 0) {
 			return lowerTime;
 		}
@@ -1829,13 +2746,15 @@ SUMOTime GARouter::getDynBeginUpperBound(const std::string& routeName,
 
 	// Get the upper bound of the beginning time
 	for (FlowDef fd : origFlowDefs) {
-		logger->debug("qPKW: [" + StringUtilities::toString<SUMOReal>(fd.qPKW) + "], "
-				     "vPKW: [" + StringUtilities::toString<SUMOReal>(fd.vPKW) + "], "
-					 "qLKW: [" + StringUtilities::toString<SUMOReal>(fd.qLKW) + "], "
-					 "vLKW: [" + StringUtilities::toString<SUMOReal>(fd.vLKW) + "], "
-					 "isLKW: [" + StringUtilities::toString<SUMOReal>(fd.isLKW) + "], "
-					 "fLKW: [" + StringUtilities::toString<SUMOReal>(fd.fLKW) + "], "
-					 "firstSet: [" + StringUtilities::toString<bool>(fd.firstSet) + "]");
+		if (logger->isDebugEnabled()) {
+			logger->debug("qPKW: [" + StringUtilities::toString<SUMOReal>(fd.qPKW) + "], "
+					     "vPKW: [" + StringUtilities::toString<SUMOReal>(fd.vPKW) + "], "
+						 "qLKW: [" + StringUtilities::toString<SUMOReal>(fd.qLKW) + "], "
+						 "vLKW: [" + StringUtilities::toString<SUMOReal>(fd.vLKW) + "], "
+						 "isLKW: [" + StringUtilities::toString<SUMOReal>(fd.isLKW) + "], "
+						 "fLKW: [" + StringUtilities::toString<SUMOReal>(fd.fLKW) + "], "
+						 "firstSet: [" + StringUtilities::toString<bool>(fd.firstSet) + "]");
+		}
 		if (fd.qPKW > 0 || fd.qLKW > 0) {
 			upperTime = fdTime;
 		}
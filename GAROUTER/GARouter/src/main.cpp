@@ -243,9 +243,20 @@ int main(int argc, char * argv[]) {
 		return EXIT_FAILURE;
 	}
 
-	// Evolve the genetic algorithm of the static approach
-	logger->info(">> Evolve the genetic algorithm of the static approach");
-	status = gaRouter.evolveStaticGA();
+	// Load the checkpoint to resume the evolution from
+	status = gaRouter.loadCheckpoint();
+	if (status > 0) {
+		return EXIT_FAILURE;
+	}
+
+	// Evolve the genetic algorithm of the static approach, unless the dynamic one is resumed
+	if (gaRouter.resumesDynamicGA()) {
+		logger->info(">> Restore the solution of the static approach from the checkpoint");
+		status = gaRouter.restoreStaticSolution();
+	} else {
+		logger->info(">> Evolve the genetic algorithm of the static approach");
+		status = gaRouter.evolveStaticGA();
+	}
 	if (status > 0) {
 		return EXIT_FAILURE;
 	}
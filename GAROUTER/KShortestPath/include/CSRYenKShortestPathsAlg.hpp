@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////
+///  CSRYenKShortestPathsAlg.hpp
+///  The implementation of Yen's algorithm to get the top k shortest loopless
+///  paths connecting a pair of vertices in a CSR graph.
+///
+///  @remarks The graph is never modified. The vertices and edges removed
+///           while computing a spur path are marked in stamped overlays
+///           owned by the algorithm, so several algorithm objects may run
+///           concurrently on the same graph. An algorithm object keeps its
+///           search buffers between calls and should be reused.
+///
+///  @author ctomas @date 10/16/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <CSRGraph.hpp>
+#include <IndexedHeap.hpp>
+
+class CSRYenKShortestPathsAlg {
+public:
+	explicit CSRYenKShortestPathsAlg(const CSRGraph& graph);
+
+	~CSRYenKShortestPathsAlg(void) {}
+
+	// Get the shortest path from source to target. Returns false if target is unreachable.
+	bool get_shortest_path(uint32_t source, uint32_t target, CSRPath& path);
+
+	// Get up to top_k shortest loopless paths from source to target, in increasing weight
+	void get_shortest_paths(uint32_t source,
+							uint32_t target,
+							int top_k,
+							std::vector<CSRPath>& result_list);
+
+private:
+	// Dijkstra search skipping the vertices and edges removed in the current overlay
+	bool _dijkstra(uint32_t source, uint32_t target, CSRPath& path);
+
+	// Start a new, empty removal overlay
+	void _new_overlay(void);
+
+	void _remove_edge(uint32_t edge) { m_vtEdgeRemoved[edge] = m_nOverlay; }
+	void _remove_vertex(uint32_t vertex) { m_vtVertexRemoved[vertex] = m_nOverlay; }
+	bool _is_edge_removed(uint32_t edge) const { return m_vtEdgeRemoved[edge] == m_nOverlay; }
+	bool _is_vertex_removed(uint32_t vertex) const { return m_vtVertexRemoved[vertex] == m_nOverlay; }
+
+	const CSRGraph& m_rGraph;
+
+	// Dijkstra buffers, valid for the vertices reached in the current search
+	IndexedHeap<double> m_quCandidateVertices;
+	std::vector<double> m_vtDistance;
+	std::vector<uint32_t> m_vtPredecessorEdge;
+	std::vector<uint32_t> m_vtSearch;
+	uint32_t m_nSearch;
+
+	// Removal overlays: an element is removed if marked with the current overlay
+	std::vector<uint32_t> m_vtEdgeRemoved;
+	std::vector<uint32_t> m_vtVertexRemoved;
+	uint32_t m_nOverlay;
+};
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////
+///  CSRGraph.cpp
+///  A directed, weighted graph in compressed sparse row (CSR) form, with
+///  integer vertex and edge identifiers.
+///
+///  @author ctomas @date 10/16/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdexcept>
+#include "CSRGraph.hpp"
+
+
+CSRGraph::CSRGraph(uint32_t num_vertices, const std::vector<CSRLink>& links)
+	: m_nVertexNum(num_vertices) {
+	const uint32_t num_edges = links.size();
+
+	m_vtEdgeFrom.resize(num_edges);
+	m_vtEdgeTo.resize(num_edges);
+	m_vtEdgeWeight.resize(num_edges);
+
+	// Count the outgoing edges of every vertex
+	m_vtOffset.assign(num_vertices + 1, 0);
+	for (uint32_t e = 0; e < num_edges; ++e) {
+		const CSRLink& link = links[e];
+		if (link.u >= num_vertices || link.v >= num_vertices) {
+			throw std::out_of_range("CSR graph link out of the vertex range");
+		}
+		m_vtEdgeFrom[e] = link.u;
+		m_vtEdgeTo[e] = link.v;
+		m_vtEdgeWeight[e] = link.weight;
+		m_vtOffset[link.u + 1]++;
+	}
+
+	for (uint32_t u = 0; u < num_vertices; ++u) {
+		m_vtOffset[u + 1] += m_vtOffset[u];
+	}
+
+	// Scatter the edges into their source rows, keeping the link order
+	m_vtSlotEdge.resize(num_edges);
+	m_vtSlotTarget.resize(num_edges);
+	m_vtSlotWeight.resize(num_edges);
+
+	std::vector<uint32_t> next(m_vtOffset.begin(), m_vtOffset.end() - 1);
+	for (uint32_t e = 0; e < num_edges; ++e) {
+		uint32_t slot = next[m_vtEdgeFrom[e]]++;
+		m_vtSlotEdge[slot] = e;
+		m_vtSlotTarget[slot] = m_vtEdgeTo[e];
+		m_vtSlotWeight[slot] = m_vtEdgeWeight[e];
+	}
+}
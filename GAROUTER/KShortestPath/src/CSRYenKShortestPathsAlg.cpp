@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+///  CSRYenKShortestPathsAlg.cpp
+///  The implementation of Yen's algorithm to get the top k shortest loopless
+///  paths connecting a pair of vertices in a CSR graph.
+///
+///  @remarks The spur searches of a path start at the vertex where it
+///           deviated from its parent path (Lawler's refinement).
+///
+///  @author ctomas @date 10/16/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <set>
+#include <limits>
+#include <algorithm>
+#include "CSRYenKShortestPathsAlg.hpp"
+
+
+CSRYenKShortestPathsAlg::CSRYenKShortestPathsAlg(const CSRGraph& graph)
+	: m_rGraph(graph),
+	  m_quCandidateVertices(graph.get_number_vertices()),
+	  m_vtDistance(graph.get_number_vertices(), 0.),
+	  m_vtPredecessorEdge(graph.get_number_vertices(), 0),
+	  m_vtSearch(graph.get_number_vertices(), 0),
+	  m_nSearch(0),
+	  m_vtEdgeRemoved(graph.get_number_edges(), 0),
+	  m_vtVertexRemoved(graph.get_number_vertices(), 0),
+	  m_nOverlay(0) {
+	_new_overlay();
+}
+
+
+void CSRYenKShortestPathsAlg::_new_overlay(void) {
+	if (++m_nOverlay == 0) {
+		std::fill(m_vtEdgeRemoved.begin(), m_vtEdgeRemoved.end(), 0);
+		std::fill(m_vtVertexRemoved.begin(), m_vtVertexRemoved.end(), 0);
+		m_nOverlay = 1;
+	}
+}
+
+
+bool CSRYenKShortestPathsAlg::get_shortest_path(uint32_t source, uint32_t target, CSRPath& path) {
+	_new_overlay();
+	return _dijkstra(source, target, path);
+}
+
+
+bool CSRYenKShortestPathsAlg::_dijkstra(uint32_t source, uint32_t target, CSRPath& path) {
+	// A new search stamp invalidates the distances of the previous search
+	if (++m_nSearch == 0) {
+		std::fill(m_vtSearch.begin(), m_vtSearch.end(), 0);
+		m_nSearch = 1;
+	}
+
+	m_quCandidateVertices.clear();
+	m_vtSearch[source] = m_nSearch;
+	m_vtDistance[source] = 0.;
+	m_quCandidateVertices.push_or_decrease(source, 0.);
+
+	bool found = false;
+	while (!m_quCandidateVertices.empty()) {
+		uint32_t u = m_quCandidateVertices.pop();
+		if (u == target) {
+			found = true;
+			break;
+		}
+
+		const double distance = m_vtDistance[u];
+		for (uint32_t slot = m_rGraph.first_out(u); slot < m_rGraph.first_out(u + 1); ++slot) {
+			uint32_t v = m_rGraph.slot_target(slot);
+			uint32_t edge = m_rGraph.slot_edge(slot);
+			if (_is_vertex_removed(v) || _is_edge_removed(edge)) {
+				continue;
+			}
+
+			double cost = distance + m_rGraph.slot_weight(slot);
+			if (m_vtSearch[v] != m_nSearch || cost < m_vtDistance[v]) {
+				m_vtSearch[v] = m_nSearch;
+				m_vtDistance[v] = cost;
+				m_vtPredecessorEdge[v] = edge;
+				m_quCandidateVertices.push_or_decrease(v, cost);
+			}
+		}
+	}
+
+	if (!found) {
+		return false;
+	}
+
+	// Walk the predecessor edges back from the target
+	std::vector<uint32_t>& vertices = path.vertices();
+	std::vector<uint32_t>& edges = path.edges();
+	vertices.clear();
+	edges.clear();
+
+	for (uint32_t v = target; v != source; v = m_rGraph.get_edge_source(m_vtPredecessorEdge[v])) {
+		vertices.push_back(v);
+		edges.push_back(m_vtPredecessorEdge[v]);
+	}
+	vertices.push_back(source);
+
+	std::reverse(vertices.begin(), vertices.end());
+	std::reverse(edges.begin(), edges.end());
+	path.Weight(m_vtDistance[target]);
+
+	return true;
+}
+
+
+void CSRYenKShortestPathsAlg::get_shortest_paths(uint32_t source,
+												 uint32_t target,
+												 int top_k,
+												 std::vector<CSRPath>& result_list) {
+	result_list.clear();
+	if (top_k <= 0 || source == target) {
+		return;
+	}
+
+	CSRPath shortest_path;
+	if (!get_shortest_path(source, target, shortest_path)) {
+		return;
+	}
+
+	// The vertex index where every result path deviates from its parent
+	std::vector<int> deviations;
+	result_list.push_back(shortest_path);
+	deviations.push_back(0);
+
+	// The candidates ordered by weight, and the edge sequences already generated
+	std::multimap< double, std::pair<CSRPath, int> > candidates;
+	std::set< std::vector<uint32_t> > generated;
+	generated.insert(shortest_path.edges());
+
+	CSRPath spur_path;
+	while (int(result_list.size()) < top_k) {
+		const CSRPath last_path = result_list.back();
+		const std::vector<uint32_t>& last_edges = last_path.edges();
+		const int path_length = last_path.length();
+
+		double root_cost = 0.;
+		for (int i = 0; i < deviations.back(); ++i) {
+			root_cost += m_rGraph.get_edge_weight(last_edges[i]);
+		}
+
+		for (int i = deviations.back(); i < path_length - 1; ++i) {
+			_new_overlay();
+
+			// Remove the next edge of every result sharing the root path
+			for (const CSRPath& result : result_list) {
+				const std::vector<uint32_t>& edges = result.edges();
+				if (int(edges.size()) > i && std::equal(last_edges.begin(), last_edges.begin() + i, edges.begin())) {
+					_remove_edge(edges[i]);
+				}
+			}
+
+			// Remove the root path vertices but the spur vertex
+			for (int j = 0; j < i; ++j) {
+				_remove_vertex(last_path.GetVertex(j));
+			}
+
+			if (_dijkstra(last_path.GetVertex(i), target, spur_path)) {
+				CSRPath candidate;
+				candidate.vertices().assign(last_path.vertices().begin(), last_path.vertices().begin() + i);
+				candidate.vertices().insert(candidate.vertices().end(), spur_path.vertices().begin(), spur_path.vertices().end());
+				candidate.edges().assign(last_edges.begin(), last_edges.begin() + i);
+				candidate.edges().insert(candidate.edges().end(), spur_path.edges().begin(), spur_path.edges().end());
+				candidate.Weight(root_cost + spur_path.Weight());
+
+				if (generated.insert(candidate.edges()).second) {
+					candidates.insert(std::make_pair(candidate.Weight(), std::make_pair(candidate, i)));
+				}
+			}
+
+			root_cost += m_rGraph.get_edge_weight(last_edges[i]);
+		}
+
+		if (candidates.empty()) {
+			break;
+		}
+
+		result_list.push_back(candidates.begin()->second.first);
+		deviations.push_back(candidates.begin()->second.second);
+		candidates.erase(candidates.begin());
+	}
+}
@@ -76,6 +76,31 @@ public:
      * @param message text std::string to be sent to the log.
      */
     void fatal(const std::string & message);
+
+    /**
+     * Checks whether the messages of a level are written.
+     * Hot paths call it before building a message.
+     *
+     * @param level The severity level, one of the CLog levels.
+     * @return      <code>true</code> if the messages of the level are written.
+     */
+    bool isEnabled(int level) const {
+        return (level >= logLevel) && (logLevel != CLog::LOG_UNDEFINED_LEVEL);
+    }
+
+    /**
+     * Checks whether the debug messages are written.
+     *
+     * @return <code>true</code> if the debug messages are written.
+     */
+    bool isDebugEnabled(void) const {
+        return isEnabled(CLog::LOG_DEBUG_LEVEL);
+    }
+
+    /**
+     * Waits until every message logged so far is written.
+     */
+    void flush(void);
    
 private:
     
@@ -84,6 +109,9 @@ private:
     
     //! String to store the logName where the messages will be dumped
     std::string logName;
+
+    //! The level of the log, cached to leave out the disabled messages cheaply
+    int logLevel;
 };
 
 } /* namespace */
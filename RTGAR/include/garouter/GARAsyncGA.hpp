@@ -0,0 +1,173 @@
+/*
+ * GARAsyncGA.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARASYNCGA_HPP_
+#define GARASYNCGA_HPP_
+
+#include <ga/GABaseGA.h>
+#include <ga/GAPopulation.h>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <condition_variable>
+#include <cstdint>
+
+namespace gar {
+
+/**
+ * @brief This class implements an asynchronous steady-state genetic algorithm.
+ * The master thread keeps as many children in evaluation as there are worker threads. As soon as
+ * an evaluation completes, the child is added to the population, the worst individual is removed,
+ * and a new child is bred and handed to the idle worker. There is no generational barrier, so the
+ * workers keep busy however skewed the evaluation costs are.
+ *
+ * The master thread does all the breeding, so the GAlib random generator is never shared.
+ * A generation is as many completed evaluations as there are individuals in the population.
+ */
+class GARAsyncGA : public GAGeneticAlgorithm {
+public:
+	GADefineIdentity("GARAsyncGA", 253);
+
+	/**
+	 * Register the default parameters of the algorithm: those of the steady-state algorithm.
+	 * @param params	The parameter list.
+	 * @return			The parameter list.
+	 */
+	static GAParameterList& registerDefaultParameters(GAParameterList& params);
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other genetic algorithm.
+	 */
+	GARAsyncGA(const GARAsyncGA& other) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param genome	The genome of the individuals.
+	 */
+	GARAsyncGA(const GAGenome& genome);
+
+	/**
+	 * Virtual destructor. It waits for the evaluations in flight and joins the worker threads.
+	 */
+	virtual ~GARAsyncGA();
+
+	/**
+	 * Initialize the population, evaluate it on the worker threads, and hand a child to every worker.
+	 * @param seed	The random seed.
+	 */
+	virtual void initialize(unsigned int seed = 0);
+
+	/**
+	 * Replace as many individuals as there are in the population with evaluated children,
+	 * breeding a new child as soon as each evaluation completes.
+	 */
+	virtual void step();
+
+	/**
+	 * Wait for the evaluations in flight and discard their children.
+	 * The workers are idle afterwards, until the algorithm is initialized again.
+	 */
+	void stop(void);
+
+	/**
+	 * Get the number of worker threads, which is the number of evaluations in flight.
+	 * @return	The number of worker threads.
+	 */
+	unsigned int numThreads(void) const;
+
+	/**
+	 * Set the number of worker threads. It takes effect on the next initialization.
+	 * @param n	The number of worker threads.
+	 * @return	The number of worker threads.
+	 */
+	unsigned int numThreads(unsigned int n);
+
+	/**
+	 * Get the share of the time the workers spent evaluating since the initialization.
+	 * @return	The worker utilization, between 0 and 1.
+	 */
+	double utilization(void) const;
+
+private:
+	/**
+	 * The worker thread loop.
+	 */
+	void work(void);
+
+	/**
+	 * Start the worker threads, stopping the running ones first if their number changed.
+	 */
+	void startWorkers(void);
+
+	/**
+	 * Hand a genome to the workers.
+	 * @param pGenome	The genome to evaluate.
+	 */
+	void submit(GAGenome* pGenome);
+
+	/**
+	 * Wait for an evaluated genome.
+	 * @return	The first evaluated genome not collected yet.
+	 */
+	GAGenome* collect(void);
+
+	/**
+	 * Rethrow the first exception thrown by an evaluation, if any.
+	 */
+	void rethrow(void);
+
+	/**
+	 * Breed a child from two parents selected in the population.
+	 * @return	The new child, not evaluated yet.
+	 */
+	GAGenome* breed(void);
+
+	//! The worker threads
+	std::vector<std::thread> workers;
+
+	//! Guards the queues
+	std::mutex mtx;
+
+	//! Wakes up the workers when a genome is submitted or the workers stop
+	std::condition_variable jobCond;
+
+	//! Wakes up the master when a genome is evaluated
+	std::condition_variable resultCond;
+
+	//! The genomes waiting for a worker
+	std::deque<GAGenome*> jobs;
+
+	//! The evaluated genomes waiting for the master
+	std::deque<GAGenome*> results;
+
+	//! The number of genomes submitted and not collected yet
+	size_t inFlight;
+
+	//! Whether the workers are stopping
+	bool stopping;
+
+	//! The first exception thrown by an evaluation
+	std::exception_ptr error;
+
+	//! The number of worker threads
+	unsigned int threads;
+
+	//! The time the workers spent evaluating, in nanoseconds
+	std::atomic<uint64_t> busyNanos;
+
+	//! The initialization time
+	std::chrono::steady_clock::time_point startTime;
+};
+
+} /* namespace gar */
+
+#endif /* GARASYNCGA_HPP_ */
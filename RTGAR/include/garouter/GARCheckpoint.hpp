@@ -0,0 +1,257 @@
+/*
+ * GARCheckpoint.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARCHECKPOINT_HPP_
+#define GARCHECKPOINT_HPP_
+
+#include <CLogger.hpp>
+#include <ga/ga.h>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+using common::CLogger;
+
+namespace gar {
+
+/**
+ * @brief This class implements the checkpoint of an evolution: the genes and scores of the
+ * population, the generation reached, the seed of the run and the statistics of the GA, which
+ * hold the convergence history and the best individuals ever found. The dynamic checkpoints also
+ * keep the genes of the static solution, so a run can resume the dynamic approach without
+ * evolving the static one again.
+ *
+ * The checkpoint is a compact binary file, written to a temporary file first and renamed,
+ * so a crash while writing leaves the previous checkpoint intact.
+ *
+ * A resumed evolution initializes its population from the checkpoint with the population
+ * initializer, which also restores the scores, so the individuals are not evaluated again.
+ * The statistics are restored next, and the population is scaled again from the restored scores,
+ * which is all the state the GAlib scaling and selection schemes keep. Every checkpoint generation
+ * reseeds the random generator of the GA from the run seed and the generation, in the checkpointed
+ * run as in the resumed one, so both follow the same trajectory.
+ */
+class GARCheckpoint {
+public:
+	/**
+	 * The evolution approach of a checkpoint.
+	 */
+	enum Approach : uint8_t { STATIC = 0, DYNAMIC = 1 };
+
+	/**
+	 * Deleted default constructor.
+	 */
+	GARCheckpoint() = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param logger	The logger.
+	 */
+	GARCheckpoint(CLogger* logger);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARCheckpoint() = default;
+
+	/**
+	 * Capture the population of a genetic algorithm.
+	 * @param ga			The genetic algorithm.
+	 * @param approach		The evolution approach.
+	 * @param generation	The generation reached, counted from the beginning of the run.
+	 * @param seed			The seed of the run.
+	 * @return				<code>0</code> if the population is captured,
+	 * 						<code>1</code> if its genomes can't be checkpointed.
+	 */
+	int capture(const GAGeneticAlgorithm& ga, Approach approach, uint32_t generation, uint32_t seed);
+
+	/**
+	 * Capture the genes of the static solution, kept by the dynamic checkpoints.
+	 * @param solution	The static solution.
+	 * @return			<code>0</code> if the solution is captured,
+	 * 					<code>1</code> if its genome can't be checkpointed.
+	 */
+	int captureStaticSolution(const GAGenome& solution);
+
+	/**
+	 * Write the checkpoint to a file.
+	 * @param path	The checkpoint file.
+	 * @return		<code>0</code> if the checkpoint is written, <code>1</code> otherwise.
+	 */
+	int save(const std::string& path) const;
+
+	/**
+	 * Read the checkpoint from a file.
+	 * @param path	The checkpoint file.
+	 * @return		<code>0</code> if the checkpoint is read, <code>1</code> otherwise.
+	 */
+	int load(const std::string& path);
+
+	/**
+	 * Restore the genes and the score of a population individual.
+	 * @param genome	The genome to restore.
+	 * @param i			The index of the individual in the checkpoint population.
+	 * @return			<code>0</code> if the genome is restored, <code>1</code> otherwise.
+	 */
+	int restore(GAGenome& genome, int i) const;
+
+	/**
+	 * Restore the statistics of a genetic algorithm whose population was restored from the
+	 * checkpoint: the generation, the operator counters, the performance measures, the
+	 * convergence history and the best individuals ever found. The population is scaled again.
+	 * @param ga	The genetic algorithm, already initialized.
+	 * @return		<code>0</code> if the statistics are restored,
+	 * 				<code>1</code> if the scaling or selection scheme differs from the checkpointed one,
+	 * 				or if the genetic algorithm was not created checkpointable by the factory.
+	 */
+	int restoreStatistics(GAGeneticAlgorithm& ga) const;
+
+	/**
+	 * Restore the genes of the static solution.
+	 * @param genome	The genome to restore.
+	 * @return			<code>0</code> if the genome is restored, <code>1</code> otherwise.
+	 */
+	int restoreStaticSolution(GAGenome& genome) const;
+
+	/**
+	 * The population initializer restoring the population from the checkpoint
+	 * set as the population user data.
+	 * @param pop	The population to initialize.
+	 */
+	static void PopulationInitializer(GAPopulation& pop);
+
+	/**
+	 * Derive the seed of the random generator at a checkpoint generation.
+	 * @param seed			The seed of the run.
+	 * @param generation	The generation of the checkpoint.
+	 * @return				A nonzero seed.
+	 */
+	static uint32_t deriveSeed(uint32_t seed, uint32_t generation);
+
+	/**
+	 * Get the evolution approach.
+	 * @return	The evolution approach.
+	 */
+	Approach getApproach(void) const;
+
+	/**
+	 * Get the generation reached.
+	 * @return	The generation reached.
+	 */
+	uint32_t getGeneration(void) const;
+
+	/**
+	 * Get the seed of the run.
+	 * @return	The seed.
+	 */
+	uint32_t getSeed(void) const;
+
+	/**
+	 * Get the number of individuals.
+	 * @return	The population size.
+	 */
+	int getPopulationSize(void) const;
+
+	/**
+	 * Check whether the checkpoint keeps the static solution.
+	 * @return	<code>true</code> if it keeps the static solution, <code>false</code> otherwise.
+	 */
+	bool hasStaticSolution(void) const;
+
+	//! The magic bytes at the beginning of a checkpoint file
+	static const char MAGIC[8];
+
+	//! The checkpoint file format version
+	static const uint32_t VERSION;
+
+private:
+	/**
+	 * The genes of a genome.
+	 */
+	struct Genes {
+		//! The size in bytes of a gene
+		uint32_t geneSize;
+
+		//! The gene values
+		std::vector<int32_t> values;
+	};
+
+	/**
+	 * The statistics of a genetic algorithm.
+	 */
+	struct Statistics {
+		//! The generation and the operator counters
+		std::vector<uint32_t> counters;
+
+		//! The on-line and off-line performance measures and the extreme scores ever found
+		std::vector<float> measures;
+
+		//! The number of best scores recorded for the convergence
+		uint32_t numConvergence;
+
+		//! The best scores of the last generations, as a ring
+		std::vector<float> convergence;
+
+		//! The genes of the best individuals ever found
+		std::vector<Genes> best;
+
+		//! The scores of the best individuals ever found
+		std::vector<float> bestScores;
+
+		//! The class name of the scaling scheme
+		std::string scaling;
+
+		//! The class name of the selection scheme
+		std::string selection;
+	};
+
+	/**
+	 * Read the genes of a genome.
+	 * @param genome	The genome.
+	 * @param genes		The genes, set on success.
+	 * @return			<code>0</code> if the genes are read,
+	 * 					<code>1</code> if the genome is not an array of 16 or 32-bit integers.
+	 */
+	static int getGenes(const GAGenome& genome, Genes& genes);
+
+	/**
+	 * Write the genes of a genome.
+	 * @param genome	The genome.
+	 * @param genes		The genes.
+	 * @return			<code>0</code> if the genes are written,
+	 * 					<code>1</code> if they don't fit the genome.
+	 */
+	static int setGenes(GAGenome& genome, const Genes& genes);
+
+	//! The logger
+	CLogger* logger;
+
+	//! The evolution approach
+	Approach approach;
+
+	//! The generation reached
+	uint32_t generation;
+
+	//! The seed of the run
+	uint32_t seed;
+
+	//! The genes of the individuals
+	std::vector<Genes> individuals;
+
+	//! The scores of the individuals
+	std::vector<float> scores;
+
+	//! The genes of the static solution, empty in the static checkpoints
+	Genes staticSolution;
+
+	//! The statistics of the genetic algorithm
+	Statistics statistics;
+};
+
+} /* namespace gar */
+
+#endif /* GARCHECKPOINT_HPP_ */
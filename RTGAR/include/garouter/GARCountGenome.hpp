@@ -0,0 +1,123 @@
+/*
+ * GARCountGenome.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARCOUNTGENOME_HPP_
+#define GARCOUNTGENOME_HPP_
+
+#include <ga/ga.h>
+#include <cstdint>
+
+namespace gar {
+
+class GARStaticObjData;
+
+/**
+ * @brief This class implements the count-per-route genome of the static approach.
+ * The genome has one gene per candidate route of every OD pair, laid out as the candidate routes
+ * in the gene layout of the static objective data. A gene holds the number of trips of its OD pair
+ * assigned to its route, so the genes of an OD pair are a composition of the OD pair trip count.
+ * The size of the genome, and the cost of its genetic operators and evaluation, scale with the
+ * number of candidate routes instead of the number of vehicles.
+ * The initialization, mutation and crossover operators of the genome keep the trip total of every OD pair.
+ * The genome user data must be the static objective data the gene layout is taken from.
+ */
+class GARCountGenome: public GA1DArrayGenome<int> {
+public:
+	GADefineIdentity("GARCountGenome", 251);
+
+	/**
+	 * Deleted default constructor.
+	 */
+	GARCountGenome() = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param pData		The static objective data holding the gene layout. It is set as the genome user data.
+	 * @param f			The objective function of the genome.
+	 */
+	GARCountGenome(const GARStaticObjData const* pData, GAGenome::Evaluator f);
+
+	/**
+	 * Copy constructor.
+	 * @param other	The genome to copy.
+	 */
+	GARCountGenome(const GARCountGenome& other);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARCountGenome() = default;
+
+	/**
+	 * Clone the genome.
+	 * @param flag	Whether the contents or only the attributes of the genome are cloned.
+	 * @return		A new copy of the genome.
+	 */
+	virtual GAGenome* clone(GAGenome::CloneMethod flag = CONTENTS) const;
+
+	/**
+	 * Assign the trips of every OD pair to its candidate routes uniformly at random.
+	 * @param g	The genome.
+	 */
+	static void Initializer(GAGenome& g);
+
+	/**
+	 * @brief Move trips between the candidate routes of the OD pairs.
+	 * Every route carrying trips is picked with the mutation probability, and a random share of up to
+	 * half of its trips is moved to another candidate route of the same OD pair.
+	 * @param g		The genome.
+	 * @param pmut	The mutation probability.
+	 * @return		The number of mutations.
+	 */
+	static int Mutator(GAGenome& g, float pmut);
+
+	/**
+	 * @brief Blend the route counts of the parents OD pair by OD pair.
+	 * For every OD pair a random weight <code>alpha</code> is drawn. The first child takes
+	 * <code>alpha</code> times the counts of the mother plus <code>1 - alpha</code> times the counts
+	 * of the father, and the second child the complementary blend. The counts are rounded down and
+	 * the trips lost by the rounding are given to the routes with the largest remainders, so the
+	 * children keep the trip total of every OD pair.
+	 * @param mom	The mother genome.
+	 * @param dad	The father genome.
+	 * @param bro	The first child genome, if any.
+	 * @param sis	The second child genome, if any.
+	 * @return		The number of children generated.
+	 */
+	static int Crossover(const GAGenome& mom, const GAGenome& dad, GAGenome* bro, GAGenome* sis);
+
+	/**
+	 * Compute the share of trips assigned to different routes in two genomes.
+	 * @param g1	A genome.
+	 * @param g2	Another genome.
+	 * @return		A float number between 0 (same) and 1 (entirely different).
+	 */
+	static float Comparator(const GAGenome& g1, const GAGenome& g2);
+
+private:
+	/**
+	 * Write the blend of the parent route counts of an OD pair into a child.
+	 * @param child	The child genome.
+	 * @param mom	The mother genome.
+	 * @param dad	The father genome.
+	 * @param alpha	The weight of the mother counts.
+	 * @param first	The first gene of the OD pair.
+	 * @param last	The gene past the last one of the OD pair.
+	 * @param trips	The trip total of the OD pair.
+	 */
+	static void blend(GARCountGenome& child,
+					  const GARCountGenome& mom,
+					  const GARCountGenome& dad,
+					  double alpha,
+					  uint32_t first,
+					  uint32_t last,
+					  uint32_t trips);
+};
+
+} /* namespace gar */
+
+#endif /* GARCOUNTGENOME_HPP_ */
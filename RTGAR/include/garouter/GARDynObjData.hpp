@@ -16,6 +16,11 @@
 #include <GARDetectorFlow.hpp>
 #include <GARRouteCont.hpp>
 #include <GARDetectorCon.hpp>
+#include <GARSumoWorkerPool.hpp>
+#include <GARMesoSim.hpp>
+#include <GARLoopMeasReader.hpp>
+#include <GARFitnessCache.hpp>
+#include <GARSimResultStore.hpp>
 #include <utils/common/SUMOTime.h>
 #include <ga/ga.h>
 
@@ -23,8 +28,6 @@ using common::CLogger;
 
 namespace gar {
 
-typedef GA1DArrayAlleleGenome<const char*> genome_static;
-
 /**
  * @brief This class implements the data required in the objective function of the genome.
  * This is the data required to perform a SUMO simulation.
@@ -34,6 +37,8 @@ typedef GA1DArrayAlleleGenome<const char*> genome_static;
  * - The route file name
  * - The emitters file name
  * - The induction-loop file name
+ * - The SUMO executable and the pool of SUMO worker sandboxes
+ * - The in-process mesoscopic simulator, if it replaces SUMO
  * - The begin time in seconds
  * - The end time in seconds
  * - The route description data set
@@ -86,6 +91,47 @@ public:
 	 */
 	std::string getLoopFile(void) const;
 
+	/**
+	 * Get the SUMO executable.
+	 * @return	The SUMO executable.
+	 */
+	std::string getSumoBinary(void) const;
+
+	/**
+	 * Get the pool of SUMO worker sandboxes.
+	 * @return	A pointer to the pool of SUMO worker sandboxes,
+	 * 			or <code>nullptr</code> if the simulations run on the shared files.
+	 */
+	GARSumoWorkerPool* getpWorkerPool(void) const;
+
+	/**
+	 * Get the in-process mesoscopic simulator.
+	 * @return	A pointer to the mesoscopic simulator,
+	 * 			or <code>nullptr</code> if the genomes are evaluated with SUMO.
+	 */
+	const GARMesoSim const* getpMesoSim(void) const;
+
+	/**
+	 * Get the induction loop measurement reader.
+	 * @return	A pointer to the induction loop measurement reader,
+	 * 			or <code>nullptr</code> if it is not built.
+	 */
+	const GARLoopMeasReader const* getpLoopReader(void) const;
+
+	/**
+	 * Get the genome score cache.
+	 * @return	A pointer to the genome score cache,
+	 * 			or <code>nullptr</code> if the scores are not cached.
+	 */
+	GARFitnessCache* getpFitnessCache(void) const;
+
+	/**
+	 * Get the persistent store of simulation results.
+	 * @return	A pointer to the simulation result store,
+	 * 			or <code>nullptr</code> if the results are not persisted.
+	 */
+	GARSimResultStore* getpSimStore(void) const;
+
 	/**
 	 * Get the simulation beginning time in seconds.
 	 * @return	The beginning time in seconds.
@@ -184,6 +230,42 @@ public:
 	 */
 	void setLoopFile(const std::string& loopFile);
 
+	/**
+	 * Set the SUMO executable.
+	 * @param sumoBinary	The SUMO executable.
+	 */
+	void setSumoBinary(const std::string& sumoBinary);
+
+	/**
+	 * Set the pool of SUMO worker sandboxes.
+	 * @param pWorkerPool	A pointer to the pool of SUMO worker sandboxes.
+	 */
+	void setpWorkerPool(GARSumoWorkerPool* pWorkerPool);
+
+	/**
+	 * Set the in-process mesoscopic simulator.
+	 * @param pMesoSim	A pointer to the mesoscopic simulator.
+	 */
+	void setpMesoSim(const GARMesoSim const* pMesoSim);
+
+	/**
+	 * Set the induction loop measurement reader.
+	 * @param pLoopReader	A pointer to the induction loop measurement reader.
+	 */
+	void setpLoopReader(const GARLoopMeasReader const* pLoopReader);
+
+	/**
+	 * Set the genome score cache.
+	 * @param pFitnessCache	A pointer to the genome score cache.
+	 */
+	void setpFitnessCache(GARFitnessCache* pFitnessCache);
+
+	/**
+	 * Set the persistent store of simulation results.
+	 * @param pSimStore	A pointer to the simulation result store.
+	 */
+	void setpSimStore(GARSimResultStore* pSimStore);
+
 	/**
 	 * Set the simulation beginning time in seconds.
 	 * @param begin	The beginning time in seconds.
@@ -247,10 +329,10 @@ public:
 
 	/**
 	 * Set the routes solution from the static approach.
-	 * @param genomeSolution  The set of routes which is the solution
-	 * 						  from the static GA.
+	 * @param routeNames  The route names decoded from the solution
+	 * 					  of the static GA.
 	 */
-	void setRoutesSolution(const gar::genome_static& genomeSolution);
+	void setRoutesSolution(const std::vector<std::string>& routeNames);
 
 	/**
 	 * Add an entry that maps an induction loop identifier to a detector data.
@@ -275,6 +357,24 @@ private:
 	//! The induction-loop file name (output)
 	std::string loopFile;
 
+	//! The SUMO executable
+	std::string sumoBinary;
+
+	//! The pool of SUMO worker sandboxes
+	GARSumoWorkerPool* pWorkerPool;
+
+	//! The in-process mesoscopic simulator
+	const GARMesoSim const* pMesoSim;
+
+	//! The induction loop measurement reader
+	const GARLoopMeasReader const* pLoopReader;
+
+	//! The genome score cache
+	GARFitnessCache* pFitnessCache;
+
+	//! The persistent store of simulation results
+	GARSimResultStore* pSimStore;
+
 	//! The simulation begin time in seconds
 	SUMOTime begin;
 
@@ -12,6 +12,7 @@
 #include <GARDetectorCon.hpp>
 #include <GARDetectorFlow.hpp>
 #include <GARRouteCont.hpp>
+#include <GARDynObjData.hpp>
 #include <utils/common/StdDefs.h>
 #include <ga/ga.h>
 
@@ -44,6 +45,87 @@ public:
 	 */
 	static float objective(GAGenome& __genome);
 
+	/**
+	 * Score a genome, reusing the detector flows stored by a previous run if there is a
+	 * simulation result store, and storing the flows of a new simulation otherwise.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @param key		The hash of the genome genes. It is ignored if there is no store.
+	 * @return			The score assigned to the genome.
+	 */
+	static float scoreGenome(const genome_dyn& genome,
+							 const GARDynObjData const* pData,
+							 const Hash128& key);
+
+	/**
+	 * Simulate a genome with the configured simulator: the in-process mesoscopic simulator,
+	 * a SUMO worker sandbox, or SUMO on the shared files.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @return			The simulated detector flows, or <code>nullptr</code> if the simulation fails.
+	 */
+	static std::shared_ptr<GARDetectorFlows> simulate(const genome_dyn& genome,
+													  const GARDynObjData const* pData);
+
+	/**
+	 * Compute the score cache key of a genome.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @return			The hash of the genome genes.
+	 */
+	static Hash128 genomeKey(const genome_dyn& genome);
+
+	/**
+	 * Evaluate a genome with a SUMO simulation run on the given files.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @param loopFile	The induction loop file.
+	 * @param emitFile	The emitter file to write.
+	 * @param measFile	The induction loop measurement file written by the simulation.
+	 * 					If empty, the file is searched for in the RTGAR directory.
+	 * @return			The score assigned to the genome.
+	 */
+	static float evaluate(const genome_dyn& genome,
+						  const GARDynObjData const* pData,
+						  const std::string& loopFile,
+						  const std::string& emitFile,
+						  const std::string& measFile);
+
+	/**
+	 * Simulate a genome with SUMO on the given files.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @param loopFile	The induction loop file.
+	 * @param emitFile	The emitter file to write.
+	 * @param measFile	The induction loop measurement file written by the simulation.
+	 * 					If empty, the file is searched for in the RTGAR directory.
+	 * @return			The simulated detector flows, or <code>nullptr</code> if the simulation fails.
+	 */
+	static std::shared_ptr<GARDetectorFlows> simulateSUMO(const genome_dyn& genome,
+														  const GARDynObjData const* pData,
+														  const std::string& loopFile,
+														  const std::string& emitFile,
+														  const std::string& measFile);
+
+	/**
+	 * Evaluate a genome with the in-process mesoscopic simulator.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @return			The score assigned to the genome.
+	 * @see GARMesoSim
+	 */
+	static float evaluateMeso(const genome_dyn& genome,
+							  const GARDynObjData const* pData);
+
+	/**
+	 * Simulate a genome with the in-process mesoscopic simulator.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The data required by the objective function.
+	 * @return			The simulated detector flows, or <code>nullptr</code> if the simulation fails.
+	 * @see GARMesoSim
+	 */
+	static std::shared_ptr<GARDetectorFlows> simulateMeso(const genome_dyn& genome,
+														  const GARDynObjData const* pData);
+
 	/**
 	 * Write the emitter file containing the vehicle trips to be performed
 	 * by the SUMO simulation.
@@ -72,6 +154,7 @@ public:
 
 	/**
 	 * Run the SUMO simulation.
+	 * @param sumoBinary	The SUMO executable.
 	 * @param netFile	The network file.
 	 * @param loopFile	The induction loop file.
 	 * @param rouFile	The route file.
@@ -81,7 +164,8 @@ public:
 	 * @return			<code>-1</code> if the SUMO simulation if the SUMO simulation can't be executed,
 	 * 					<code>status</code> the return status of the SUMO simulation executed by popen().
 	 */
-	static int runSUMO(const std::string& netFile,
+	static int runSUMO(const std::string& sumoBinary,
+					   const std::string& netFile,
 					   const std::string& loopFile,
 					   const std::string& rouFile,
 					   const std::string& emittFile,
@@ -100,13 +184,16 @@ public:
 
 	/**
 	 * Read the induction loop measurements and build the detector flow data.
+	 * @param measFile		The induction loop measurement file.
 	 * @param loops2Dets	A map that connects induction loop identifiers with detector data.
 	 * @param beginTime	 	The simulation beginning time in seconds.
 	 * @param endTime		The simulation end time in seconds.
 	 * @param timeStep		The interval of time in seconds between two successive detector data.
-	 * @return
+	 * @return				The detector flows, or <code>nullptr</code> if the file can't be read.
+	 * @see GARLoopMeasReader
 	 */
-	static std::shared_ptr<GARDetectorFlows> readLoopMeasures(const gar::loop2det_map& loops2Dets,
+	static std::shared_ptr<GARDetectorFlows> readLoopMeasures(const std::string& measFile,
+															  const gar::loop2det_map& loops2Dets,
 														      const SUMOTime& beginTime,
 													          const SUMOTime& endTime,
 														      const SUMOTime& timeStep);
@@ -0,0 +1,139 @@
+/*
+ * GARFitnessCache.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARFITNESSCACHE_HPP_
+#define GARFITNESSCACHE_HPP_
+
+#include <HashUtilities.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+using common::Hash128;
+
+namespace gar {
+
+/**
+ * @brief This class implements a bounded cache of genome scores keyed by the 128-bit hash of the genes.
+ * The entries are spread over several shards, each one guarded by its own mutex, so the threads
+ * evaluating a population concurrently seldom contend. When a shard is full, its oldest entry is evicted.
+ * The cache counts the lookup hits and misses.
+ */
+class GARFitnessCache {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARFitnessCache() = delete;
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other cache.
+	 */
+	GARFitnessCache(const GARFitnessCache& other) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param capacity	The maximum number of cached scores.
+	 */
+	GARFitnessCache(size_t capacity);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARFitnessCache() = default;
+
+	/**
+	 * Compute the hash key of a gene array.
+	 * @param genes		The genes.
+	 * @param numGenes	The number of genes.
+	 * @return			The hash key of the genes.
+	 */
+	template<class T>
+	static Hash128 key(const T* genes, size_t numGenes) {
+		return common::HashUtilities::hash128(genes, numGenes * sizeof(T));
+	}
+
+	/**
+	 * Look up the score of a genome.
+	 * @param key	The hash key of the genome genes.
+	 * @param score	The cached score, set on a hit.
+	 * @return		<code>true</code> on a hit, <code>false</code> on a miss.
+	 */
+	bool find(const Hash128& key, float& score);
+
+	/**
+	 * Store the score of a genome, evicting the oldest entry of its shard if it is full.
+	 * @param key	The hash key of the genome genes.
+	 * @param score	The score.
+	 */
+	void insert(const Hash128& key, float score);
+
+	/**
+	 * Get the number of lookup hits.
+	 * @return	The number of hits.
+	 */
+	uint64_t getHits(void) const;
+
+	/**
+	 * Get the number of lookup misses.
+	 * @return	The number of misses.
+	 */
+	uint64_t getMisses(void) const;
+
+	/**
+	 * Reset the hit and miss counters.
+	 */
+	void resetCounters(void);
+
+private:
+	/**
+	 * A cache shard.
+	 */
+	struct Shard {
+		//! The shard mutex
+		std::mutex mtx;
+
+		//! The cached scores
+		std::unordered_map<Hash128, float, common::Hash128Hasher> scores;
+
+		//! The keys in insertion order, used as a ring to evict the oldest entry
+		std::vector<Hash128> ring;
+
+		//! The next ring position to fill
+		size_t next;
+	};
+
+	//! The number of shards
+	static const size_t NUM_SHARDS;
+
+	/**
+	 * Get the shard of a key.
+	 * @param key	The hash key.
+	 * @return		The shard holding the key.
+	 */
+	Shard& shard(const Hash128& key);
+
+	//! The maximum number of entries per shard
+	size_t shardCapacity;
+
+	//! The shards
+	std::unique_ptr<Shard[]> shards;
+
+	//! The number of lookup hits
+	std::atomic<uint64_t> hits;
+
+	//! The number of lookup misses
+	std::atomic<uint64_t> misses;
+};
+
+} /* namespace gar */
+
+#endif /* GARFITNESSCACHE_HPP_ */
@@ -16,6 +16,53 @@ using common::CLogger;
 
 namespace gar {
 
+/**
+ * The interface of the genetic algorithms whose statistics can be restored from a checkpoint,
+ * which GAlib only exposes as constant.
+ */
+class GARCheckpointable {
+public:
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARCheckpointable() = default;
+
+	/**
+	 * Get the statistics of the genetic algorithm to restore them.
+	 * @return	The statistics.
+	 */
+	virtual GAStatistics& restorableStatistics(void) = 0;
+};
+
+/**
+ * A GAlib genetic algorithm (GASimpleGA | GASteadyStateGA | GAIncrementalGA) exposing its statistics.
+ */
+template<class GA>
+class GARCheckpointableGA : public GA, public GARCheckpointable {
+public:
+	/**
+	 * Parameterized constructor.
+	 * @param genome	The genome definition.
+	 */
+	explicit GARCheckpointableGA(const GAGenome& genome)
+	: GA(genome) {
+		// Intentionally left empty
+	}
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARCheckpointableGA() = default;
+
+	/**
+	 * Get the statistics of the genetic algorithm to restore them.
+	 * @return	The statistics.
+	 */
+	GAStatistics& restorableStatistics(void) override {
+		return this->stats;
+	}
+};
+
 /**
  * This class implements the factory method pattern to create the suitable
  * genetic algorithm object determined by the 'genetic-algorithm' input option.
@@ -36,12 +83,13 @@ public:
 	 * @brief The genetic algorithm factory method.
 	 * Creates an instance of the suitable genetic algorithm engine class according to
 	 * the given genetic algorithm type argument.
-	 * @param gaType	The genetic algorithm type (Simple | SteadyState | Incremental | Deme).
+	 * @param gaType	The genetic algorithm type (Simple | SteadyState | Incremental | Deme | Island | AsyncSteadyState).
 	 * @param pGenome	The genetic algorithm genome definition.
 	 * @param params	The genetic algorithm parameters.
 	 * @param logger	Referene to the ga-router logger.
 	 * @return			A pointer to the suitable genetic algorithm engine object that inherits from the
-	 * 					GAGeneticAlgorithm virtual class.
+	 * 					GAGeneticAlgorithm virtual class. The Simple, SteadyState and Incremental
+	 * 					algorithms are checkpointable.
 	 */
 	GAGeneticAlgorithm* createGeneticAlgorithm(const std::string& gaType,
 											   const GAGenome const* pGenome,
@@ -0,0 +1,260 @@
+/*
+ * GARIslandGA.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARISLANDGA_HPP_
+#define GARISLANDGA_HPP_
+
+#include <ThreadPool.hpp>
+#include <ga/GABaseGA.h>
+#include <ga/GASimpleGA.h>
+#include <ga/GAPopulation.h>
+#include <functional>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+namespace gar {
+
+/**
+ * @brief This class implements an island-model genetic algorithm whose islands evolve concurrently.
+ * Every island is a simple genetic algorithm evolving its own population. A generation of the
+ * island model steps every island on a thread of its own, and every few generations the best
+ * individuals of each island migrate to another island, replacing its worst individuals.
+ * The migrants of an island go to the next island (ring topology) or to a random one.
+ *
+ * The GAlib random generator is shared by all the islands, so an island breeds (selection,
+ * crossover and mutation) holding the breeding lock of the island model, and releases it while
+ * its population is evaluated by the population evaluator configured on the master population.
+ * The evaluations of the islands thus overlap, and only the cheap breeding is serialized.
+ * The islands take the breeding lock in turns, in index order, so they draw the random numbers
+ * in the same order on every run, and a seeded run is reproducible for a given number of threads.
+ *
+ * The master population gathers the populations of all the islands after every generation,
+ * and the statistics are computed on it.
+ */
+class GARIslandGA : public GAGeneticAlgorithm {
+public:
+	GADefineIdentity("GARIslandGA", 252);
+
+	/**
+	 * The migration topologies.
+	 */
+	enum Topology { RING, RANDOM };
+
+	/**
+	 * Register the default parameters of the algorithm: those of the islands.
+	 * @param params	The parameter list.
+	 * @return			The parameter list.
+	 */
+	static GAParameterList& registerDefaultParameters(GAParameterList& params);
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other genetic algorithm.
+	 */
+	GARIslandGA(const GARIslandGA& other) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param genome	The genome of the individuals.
+	 */
+	GARIslandGA(const GAGenome& genome);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARIslandGA() = default;
+
+	/**
+	 * Initialize the islands, every one with a population of the configured population size,
+	 * and evaluate their populations concurrently.
+	 * @param seed	The random seed.
+	 */
+	virtual void initialize(unsigned int seed = 0);
+
+	using GAGeneticAlgorithm::populationSize;
+
+	/**
+	 * Set the population size of an island. The master population gathering the islands
+	 * grows to the population size times the number of islands on initialization.
+	 * @param n	The population size of an island.
+	 * @return	The population size.
+	 */
+	virtual int populationSize(unsigned int n);
+
+	/**
+	 * Evolve every island a generation concurrently, then migrate the best individuals
+	 * if the migration interval is over.
+	 */
+	virtual void step();
+
+	/**
+	 * Get the number of islands.
+	 * @return	The number of islands.
+	 */
+	int nIslands(void) const;
+
+	/**
+	 * Set the number of islands. It takes effect on the next initialization.
+	 * @param n	The number of islands.
+	 * @return	The number of islands.
+	 */
+	int nIslands(int n);
+
+	/**
+	 * Get the number of generations between two migrations.
+	 * @return	The migration interval, <code>0</code> if the islands never migrate.
+	 */
+	int migrationInterval(void) const;
+
+	/**
+	 * Set the number of generations between two migrations.
+	 * @param n	The migration interval, <code>0</code> if the islands never migrate.
+	 * @return	The migration interval.
+	 */
+	int migrationInterval(int n);
+
+	/**
+	 * Get the number of individuals migrating from an island.
+	 * @return	The number of migrants.
+	 */
+	int migrationNumber(void) const;
+
+	/**
+	 * Set the number of individuals migrating from an island.
+	 * @param n	The number of migrants.
+	 * @return	The number of migrants.
+	 */
+	int migrationNumber(int n);
+
+	/**
+	 * Get the migration topology.
+	 * @return	The migration topology.
+	 */
+	Topology topology(void) const;
+
+	/**
+	 * Set the migration topology.
+	 * @param t	The migration topology.
+	 * @return	The migration topology.
+	 */
+	Topology topology(Topology t);
+
+	/**
+	 * Get the maximum number of islands stepped concurrently.
+	 * @return	The number of threads, including the calling thread.
+	 */
+	unsigned int numThreads(void) const;
+
+	/**
+	 * Set the maximum number of islands stepped concurrently.
+	 * It takes effect on the next initialization.
+	 * @param n	The number of threads, including the calling thread.
+	 * @return	The number of threads.
+	 */
+	unsigned int numThreads(unsigned int n);
+
+	/**
+	 * Get the population of an island.
+	 * @param i	The island index.
+	 * @return	The island population.
+	 */
+	const GAPopulation& island(int i) const;
+
+private:
+	/**
+	 * Run a task on every island, on the island threads, holding the breeding lock in turns.
+	 * The island threads are bound to the island model while they run the task.
+	 * @param task	The task to run.
+	 */
+	void forEachIsland(const std::function<void(GASimpleGA&)>& task);
+
+	/**
+	 * Wait for the breeding turn of an island and take the breeding lock.
+	 * @param i		The island index.
+	 * @param lock	The breeding lock, released.
+	 */
+	void takeTurn(size_t i, std::unique_lock<std::mutex>& lock);
+
+	/**
+	 * Hand the breeding turn to the next running island in index order and release the breeding lock.
+	 * @param i		The island index.
+	 * @param lock	The breeding lock, held.
+	 */
+	void passTurn(size_t i, std::unique_lock<std::mutex>& lock);
+
+	/**
+	 * Migrate the best individuals of every island to its destination island.
+	 */
+	void migrate(void);
+
+	/**
+	 * Gather the individuals of all the islands into the master population.
+	 */
+	void gather(void);
+
+	/**
+	 * The population evaluator of the islands.
+	 * It evaluates the individuals with the population evaluator of the master population,
+	 * releasing the breeding lock of the island model meanwhile.
+	 * @param pop	The island population to evaluate.
+	 */
+	static void evaluate(GAPopulation& pop);
+
+	//! The breeding lock held by the thread stepping an island
+	static thread_local std::unique_lock<std::mutex>* pBreedLock;
+
+	//! The island model of the thread stepping an island
+	static thread_local GARIslandGA* pSteppingGA;
+
+	//! The island stepped by the thread
+	static thread_local size_t steppingIsland;
+
+	//! The lock serializing the breeding of the islands
+	std::mutex breedMtx;
+
+	//! Signals the islands a change of the breeding turn
+	std::condition_variable breedCond;
+
+	//! The island whose turn is to breed
+	size_t breedTurn;
+
+	//! Whether every island is running a task in the current batch
+	std::vector<bool> running;
+
+	//! The population evaluator of the master population, evaluating the island populations
+	GAPopulation::Evaluator popEvaluator;
+
+	//! The islands
+	std::vector<std::unique_ptr<GASimpleGA>> islands;
+
+	//! The threads stepping the islands
+	std::unique_ptr<common::ThreadPool> pPool;
+
+	//! The number of islands
+	int numIslands;
+
+	//! The configured population size of an island
+	int islandSize;
+
+	//! The number of generations between two migrations
+	int interval;
+
+	//! The number of individuals migrating from an island
+	int numMigrants;
+
+	//! The migration topology
+	Topology migrationTopology;
+
+	//! The maximum number of islands stepped concurrently
+	unsigned int threads;
+};
+
+} /* namespace gar */
+
+#endif /* GARISLANDGA_HPP_ */
@@ -0,0 +1,131 @@
+/*
+ * GARLoopMeasReader.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARLOOPMEASREADER_HPP_
+#define GARLOOPMEASREADER_HPP_
+
+#include <GARDetector.hpp>
+#include <GARDetectorFlow.hpp>
+#include <utils/common/SUMOTime.h>
+#include <unordered_map>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gar {
+
+/**
+ * @brief This class implements a streaming reader of the induction loop measurements written by SUMO.
+ * The measurement file is read in a single pass, tag by tag, without building a document tree.
+ * Every <code>interval</code> element is written straight into the flow of its detector and time step
+ * in the target detector flows. The XML entities of the attribute values are decoded.
+ *
+ * The detector and time step indices are computed once from the induction loop to detector map,
+ * so reading a file only looks up the loop identifier of every interval. The reader holds no state
+ * of the file being read, so concurrent reads may share a reader.
+ */
+class GARLoopMeasReader {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARLoopMeasReader(void) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param loops2Dets	A map that connects induction loop identifiers with detector data.
+	 * @param begin			The simulation beginning time in seconds.
+	 * @param end			The simulation end time in seconds.
+	 * @param timeStep		The interval of time in seconds between two successive detector data.
+	 */
+	GARLoopMeasReader(const gar::loop2det_map& loops2Dets,
+					  const SUMOTime& begin,
+					  const SUMOTime& end,
+					  const SUMOTime& timeStep);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARLoopMeasReader(void) = default;
+
+	/**
+	 * Read the induction loop measurements and build the detector flow data.
+	 * @param measFile	The induction loop measurement file.
+	 * @return			The detector flows holding the detectors with measurements,
+	 * 					or <code>nullptr</code> if the file can't be read.
+	 */
+	std::shared_ptr<GARDetectorFlows> read(const std::string& measFile) const;
+
+	/**
+	 * Read the induction loop measurements from a stream and build the detector flow data.
+	 * @param in		The stream of the induction loop measurements.
+	 * @param source	The name of the measurements source used in the error messages.
+	 * @return			The detector flows holding the detectors with measurements,
+	 * 					or <code>nullptr</code> if the measurements are malformed.
+	 */
+	std::shared_ptr<GARDetectorFlows> read(std::istream& in, const std::string& source) const;
+
+	/**
+	 * Read the induction loop measurements into the detector flows.
+	 * Only the detectors with measurements are added to the detector flows.
+	 * @param measFile	The induction loop measurement file.
+	 * @param detFlows	The detector flows to fill, spanning the simulation time of the reader.
+	 * @return			<code>0</code> if the measurements are read, <code>1</code> otherwise.
+	 */
+	int read(const std::string& measFile, GARDetectorFlows& detFlows) const;
+
+	/**
+	 * Read the induction loop measurements from a stream into the detector flows.
+	 * Only the detectors with measurements are added to the detector flows.
+	 * @param in		The stream of the induction loop measurements.
+	 * @param source	The name of the measurements source used in the error messages.
+	 * @param detFlows	The detector flows to fill, spanning the simulation time of the reader.
+	 * @return			<code>0</code> if the measurements are read, <code>1</code> if they are malformed.
+	 */
+	int read(std::istream& in, const std::string& source, GARDetectorFlows& detFlows) const;
+
+private:
+	/**
+	 * Get the value of an attribute in the text of a tag, with its XML entities decoded.
+	 * @param tag	The text of the tag, without the angle brackets.
+	 * @param name	The attribute name.
+	 * @param value	The attribute value, set if the attribute is found.
+	 * @return		<code>true</code> if the attribute is found, <code>false</code> otherwise.
+	 */
+	static bool getAttribute(const std::string& tag, const char* name, std::string& value);
+
+	/**
+	 * Decode the predefined and the numeric character XML entities of a text in place.
+	 * An unknown or malformed entity is kept as it is.
+	 * @param text	The text.
+	 */
+	static void decodeEntities(std::string& text);
+
+	//! The detector slot by induction loop identifier
+	std::unordered_map<std::string, uint32_t> loopSlots;
+
+	//! The detector identifier of every slot
+	std::vector<std::string> detectorIds;
+
+	//! The simulation beginning time in seconds
+	SUMOTime begin;
+
+	//! The simulation end time in seconds
+	SUMOTime end;
+
+	//! The time interval between two successive detector flows
+	SUMOTime timeStep;
+
+	//! The number of time steps of the detector flows
+	uint32_t numSteps;
+};
+
+} /* namespace gar */
+
+#endif /* GARLOOPMEASREADER_HPP_ */
@@ -0,0 +1,117 @@
+/*
+ * GARPopulationEvaluator.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARPOPULATIONEVALUATOR_HPP_
+#define GARPOPULATIONEVALUATOR_HPP_
+
+#include <GARBudgetTerminator.hpp>
+#include <ThreadPool.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <ga/ga.h>
+
+namespace gar {
+
+/**
+ * @brief This class implements the population evaluator of the static approach.
+ * The individuals of the population are evaluated concurrently by a pool of worker threads.
+ * Every individual is evaluated by exactly one thread, and the objective function keeps
+ * its scratch data per thread or per genome, so the scores are the same as in the
+ * serial evaluation.
+ * Once the deadline of the budget terminator is reached, the individuals left are not evaluated:
+ * they take the worst score of the population, so the evolution stops within an evaluation of
+ * its deadline instead of a generation. If no individual of the population was evaluated, they
+ * take the worst score of the previous populations, and the population holds no solution to publish.
+ */
+class GARPopulationEvaluator {
+public:
+	/**
+	 * Deleted constructor.
+	 */
+	GARPopulationEvaluator() = delete;
+
+	/**
+	 * Deleted virtual destructor.
+	 */
+	virtual ~GARPopulationEvaluator() = delete;
+
+	/**
+	 * The GA population evaluator.
+	 * Evaluates every individual of the population on the worker threads.
+	 * @param pop	The population to evaluate.
+	 */
+	static void evaluate(GAPopulation& pop);
+
+	/**
+	 * Set the number of threads evaluating the populations.
+	 * The worker threads are created once and reused in every evaluation.
+	 * @param numThreads	The number of threads, including the calling thread.
+	 */
+	static void setNumThreads(unsigned int numThreads);
+
+	/**
+	 * Get the number of threads evaluating the populations.
+	 * @return	The number of threads, including the calling thread.
+	 */
+	static unsigned int getNumThreads(void);
+
+	/**
+	 * Set the budget terminator whose deadline stops the evaluation of the populations,
+	 * forgetting the scores of the previous evolution.
+	 * @param pTerminator	The budget terminator, <code>nullptr</code> for no deadline.
+	 */
+	static void setTerminator(const GARBudgetTerminator* pTerminator);
+
+	/**
+	 * Check whether the last population evaluated had any individual evaluated before the deadline.
+	 * @return	<code>false</code> if the scores of the last population are all taken from the previous ones.
+	 */
+	static bool isLastScored(void);
+
+	/**
+	 * Check whether any individual was evaluated since the budget terminator was set.
+	 * @return	<code>false</code> if every population evaluated was left unevaluated at the deadline,
+	 * 			so the best individual so far has no true score.
+	 */
+	static bool isAnyScored(void);
+
+private:
+	/**
+	 * Give the individuals left unevaluated at the deadline the worst score of the population,
+	 * or of the previous populations if none was evaluated, so they are neither evaluated later
+	 * nor preferred to the evaluated ones.
+	 * @param pop		The population.
+	 * @param skipped	Whether every individual was left unevaluated.
+	 */
+	static void scoreSkipped(GAPopulation& pop, const std::vector<char>& skipped);
+
+	//! The pool of worker threads
+	static std::unique_ptr<common::ThreadPool> pPool;
+
+	//! The budget terminator whose deadline stops the evaluation
+	static const GARBudgetTerminator* pTerminator;
+
+	//! Guards the scores of the previous populations
+	static std::mutex scoreMtx;
+
+	//! Whether any individual was evaluated
+	static bool anyScored;
+
+	//! Whether the last population evaluated had any individual evaluated
+	static bool lastScored;
+
+	//! Whether every population evaluated was left unevaluated
+	static bool noneScored;
+
+	//! The worst score of the populations evaluated
+	static float lastWorst;
+};
+
+} /* namespace gar */
+
+#endif /* GARPOPULATIONEVALUATOR_HPP_ */
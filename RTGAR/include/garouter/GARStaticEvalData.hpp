@@ -0,0 +1,101 @@
+/*
+ * GARStaticEvalData.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARSTATICEVALDATA_HPP_
+#define GARSTATICEVALDATA_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <ga/ga.h>
+
+namespace gar {
+
+/**
+ * @brief This class implements the evaluation state attached to a genome of the static approach.
+ * It records the genes the genome had when it was last evaluated, together with the edge flow
+ * residuals (the edge flow count minus the detector flow target of every dense edge) and the
+ * sum of the squared residuals.
+ * The evaluation state travels with the genome through the GAlib copy and clone operations,
+ * so the objective function can update the residuals of the genes changed by the genetic
+ * operators instead of recounting the whole genome. The genetic operators record the genes
+ * they change, so the objective function does not have to look for them.
+ */
+class GARStaticEvalData: public GAEvalData {
+public:
+	/**
+	 * Empty constructor.
+	 */
+	GARStaticEvalData();
+
+	/**
+	 * Copy constructor.
+	 * @param other	The evaluation data to copy.
+	 */
+	GARStaticEvalData(const GARStaticEvalData& other);
+
+	/**
+	 * Default virtual destructor.
+	 */
+	virtual ~GARStaticEvalData() = default;
+
+	/**
+	 * Clone the evaluation data.
+	 * @return	A new copy of the evaluation data.
+	 */
+	virtual GAEvalData* clone() const;
+
+	/**
+	 * Copy the contents of other evaluation data.
+	 * @param orig	The evaluation data to copy.
+	 */
+	virtual void copy(const GAEvalData& orig);
+
+	/**
+	 * Check whether the evaluation state holds a previous evaluation.
+	 * @return	<code>true</code> if the genes, the residuals and the squared error sum are set.
+	 */
+	bool isValid(void) const;
+
+	/**
+	 * Invalidate the evaluation state, forcing the next evaluation to recount the genome.
+	 */
+	void invalidate(void);
+
+	/**
+	 * Record a gene changed since the last evaluation. Once half of the genes changed, the
+	 * changes are no longer recorded, since the next evaluation recounts the genome anyway.
+	 * @param gene	The gene position.
+	 */
+	void recordChange(int gene);
+
+	/**
+	 * Mark the evaluation state as updated to the genes of the genome.
+	 */
+	void commit(void);
+
+	//! The genes of the genome at the last evaluation, of the 16 or 32-bit trip genome
+	std::vector<uint32_t> genes;
+
+	//! The edge flow residuals per dense edge index at the last evaluation
+	std::vector<int32_t> residuals;
+
+	//! The sum of the squared residuals at the last evaluation
+	int64_t sqErrorSum;
+
+	//! Whether the evaluation state holds a previous evaluation
+	bool valid;
+
+	//! The gene positions changed since the last evaluation, possibly repeated
+	std::vector<int> changed;
+
+	//! Whether every gene changed since the last evaluation is recorded
+	bool tracked;
+};
+
+} /* namespace gar */
+
+#endif /* GARSTATICEVALDATA_HPP_ */
@@ -9,6 +9,10 @@
 #define GARSTATICOBJDATA_HPP_
 
 #include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
 #include <CLogger.hpp>
 #include <GARNet.hpp>
 #include <GARRouteDesc.hpp>
@@ -16,7 +20,9 @@
 #include <GARDetectorFlow.hpp>
 #include <GARRouteCont.hpp>
 #include <GARDetectorCon.hpp>
+#include <GARFitnessCache.hpp>
 #include <utils/common/SUMOTime.h>
+#include <ga/ga.h>
 
 using common::CLogger;
 
@@ -32,6 +38,14 @@ namespace gar {
  * - The emitters file name
  * - The induction-loop file name
  * - The route description data set
+ * - The route-to-edge incidence in compressed sparse row (CSR) layout
+ * - The detector flow targets of the edges carrying detectors
+ * - The gene layout of the static genome: the candidate routes of every OD pair
+ *
+ * The incidence is built once over dense edge indices, so the objective function
+ * accumulates the edge flow counts into a flat array instead of string-keyed maps.
+ * The genes of the static genome are local route indices within the candidate routes
+ * of their OD pair, which the gene layout resolves into route indices.
  */
 class GARStaticObjData {
 public:
@@ -99,7 +113,222 @@ public:
 	 */
 	void setpDetFlows(const GARDetectorFlows const* pDetFlows);
 
+	/**
+	 * @brief Build the route-to-edge incidence in compressed sparse row layout.
+	 * Every non-internal edge of the network is given a dense index following the order of the network edge map,
+	 * which is the same order the objective function scores the edges. Every route in the routes container
+	 * is given the index of its position in the container, and its edges are stored as dense edge indices.
+	 * The network and the routes container must be set before calling this method.
+	 * @return	<code>0</code> if the incidence is successfully built; <code>1</code> otherwise.
+	 */
+	int buildRouteEdgeIncidence(void);
+
+	/**
+	 * Clear the gene layout of the static genome.
+	 */
+	void clearGeneLayout(void);
+
+	/**
+	 * @brief Append the genes of an OD pair to the gene layout of the static genome.
+	 * The OD pair contributes one gene per trip, and the allele of every one of these genes
+	 * is a local index within the candidate routes of the OD pair.
+	 * The route-to-edge incidence must be built before calling this method.
+	 * @param routeNames	The candidate route names of the OD pair.
+	 * @param numGenes		The number of genes (trips) of the OD pair.
+	 * @return	<code>0</code> if the genes are successfully appended; <code>1</code> otherwise.
+	 */
+	int addOdGenes(const std::vector<std::string>& routeNames, int numGenes);
+
+	/**
+	 * @brief Build the detector flow targets per edge.
+	 * The target of an edge is the flow amount sum of the detectors placed in it. Only the dense edges
+	 * carrying detectors are stored, sorted by dense edge index, so the objective function does not
+	 * query the detector containers on every evaluation.
+	 * The route-to-edge incidence, the detectors container and the detector flows must be set before calling this method.
+	 * @return	<code>0</code> if the targets are successfully built; <code>1</code> otherwise.
+	 */
+	int buildDetectorTargets(void);
+
+	/**
+	 * Get the number of dense (non-internal) edges.
+	 * @return	The number of dense edges.
+	 */
+	uint32_t getNumEdges(void) const;
+
+	/**
+	 * Get the edge identifier of a dense edge index.
+	 * @param edgeIndex	The dense edge index.
+	 * @return	The edge identifier.
+	 */
+	const std::string& getEdgeId(uint32_t edgeIndex) const;
+
+	/**
+	 * Get the number of genes in the gene layout of the static genome.
+	 * @return	The number of genes.
+	 */
+	int getNumGenes(void) const;
+
+	/**
+	 * Get the number of candidate routes of the OD pair of a gene.
+	 * @param gene	The gene position.
+	 * @return	The number of candidate routes.
+	 */
+	uint32_t getNumGeneRoutes(int gene) const;
+
+	/**
+	 * Get the OD pair index of a gene.
+	 * @param gene	The gene position.
+	 * @return	The OD pair index.
+	 */
+	uint32_t getGeneOd(int gene) const;
+
+	/**
+	 * Get the gene offsets of the OD pairs: the genes of the OD pair <code>od</code> are
+	 * the positions <code>[offsets[od], offsets[od + 1])</code>.
+	 * @return	The gene offsets, with one more entry than OD pairs.
+	 */
+	const std::vector<uint32_t>& getOdGeneOffsets(void) const;
+
+	/**
+	 * @brief Get the route index corresponding to a gene value of the static genome.
+	 * An allele out of the candidate routes of the gene OD pair, as left by the permutation crossovers
+	 * (Cycle, Order, PartialMatch) moving values between OD pairs, is wrapped around the number
+	 * of candidate routes.
+	 * @param gene		The gene position.
+	 * @param allele	The gene value, a local index within the candidate routes of the gene OD pair.
+	 * @return	The route index, or <code>-1</code> if the OD pair of the gene has no candidate routes.
+	 */
+	int getGeneRoute(int gene, uint32_t allele) const;
+
+	/**
+	 * Get the largest number of candidate routes of an OD pair, which tells whether
+	 * the local route indices fit a 16-bit allele.
+	 * @return	The largest number of candidate routes.
+	 */
+	uint32_t getMaxOdRoutes(void) const;
+
+	/**
+	 * Get the number of OD pairs in the gene layout of the static genome.
+	 * @return	The number of OD pairs.
+	 */
+	uint32_t getNumOds(void) const;
+
+	/**
+	 * Get the number of trips of an OD pair.
+	 * @param od	The OD pair index.
+	 * @return	The number of trips.
+	 */
+	uint32_t getOdTrips(uint32_t od) const;
+
+	/**
+	 * Get the offsets of the candidate routes of the OD pairs.
+	 * The candidate routes of the OD pair <code>od</code> are in the range [offsets[od], offsets[od+1]) of the OD routes.
+	 * @return	The offsets of the candidate routes.
+	 */
+	const std::vector<uint32_t>& getOdRouteOffsets(void) const;
+
+	/**
+	 * Get the route indices of the candidate routes of the OD pairs.
+	 * @return	The route indices of the candidate routes.
+	 */
+	const std::vector<uint32_t>& getOdRoutes(void) const;
+
+	/**
+	 * Get the route description of a route index.
+	 * @param route	The route index.
+	 * @return	The route description.
+	 */
+	const GARRouteDesc& getRouteDesc(uint32_t route) const;
+
+	/**
+	 * Get the CSR row offsets of the route-to-edge incidence.
+	 * The edges of the route <code>r</code> are in the range [offsets[r], offsets[r+1]) of the edge indices.
+	 * @return	The CSR row offsets.
+	 */
+	const std::vector<uint32_t>& getRouteEdgeOffsets(void) const;
+
+	/**
+	 * Get the CSR dense edge indices of the route-to-edge incidence.
+	 * @return	The CSR dense edge indices.
+	 */
+	const std::vector<uint32_t>& getRouteEdgeIndices(void) const;
+
+	/**
+	 * Get the dense indices of the edges carrying detectors, in ascending order.
+	 * @return	The dense indices of the target edges.
+	 */
+	const std::vector<uint32_t>& getTargetEdges(void) const;
+
+	/**
+	 * Get the detector flow targets, parallel to the target edges.
+	 * @return	The detector flow targets.
+	 */
+	const std::vector<int>& getTargetFlows(void) const;
+
+	/**
+	 * Check whether the delta evaluation of the genomes is enabled.
+	 * @return	<code>true</code> if the genomes are evaluated by updating the genes changed since their last evaluation.
+	 */
+	bool isDeltaEvaluation(void) const;
+
+	/**
+	 * Enable or disable the delta evaluation of the genomes.
+	 * @param deltaEvaluation	Whether the genomes are evaluated by updating the genes changed since their last evaluation.
+	 */
+	void setDeltaEvaluation(bool deltaEvaluation);
+
+	/**
+	 * Get the genome score cache.
+	 * @return	A pointer to the genome score cache,
+	 * 			or <code>nullptr</code> if the scores are not cached.
+	 */
+	GARFitnessCache* getpFitnessCache(void) const;
+
+	/**
+	 * Set the genome score cache.
+	 * @param pFitnessCache	A pointer to the genome score cache.
+	 */
+	void setpFitnessCache(GARFitnessCache* pFitnessCache);
+
+	/**
+	 * Get the crossover operator wrapped by the delta evaluation crossover.
+	 * @return	The genome crossover operator.
+	 */
+	GAGenome::SexualCrossover getCrossover(void) const;
+
+	/**
+	 * Set the crossover operator wrapped by the delta evaluation crossover.
+	 * @param crossover	The genome crossover operator.
+	 */
+	void setCrossover(GAGenome::SexualCrossover crossover);
+
+	/**
+	 * Get the number of best individuals refined by the local search after every evaluation.
+	 * @return	The number of refined individuals, <code>0</code> if the local search is disabled.
+	 */
+	int getLocalSearchElites(void) const;
+
+	/**
+	 * Get the number of moves the local search tries on every refined individual.
+	 * @return	The number of moves.
+	 */
+	int getLocalSearchMoves(void) const;
+
+	/**
+	 * Set the local search budget.
+	 * @param elites	The number of best individuals refined after every evaluation.
+	 * @param moves		The number of moves tried on every refined individual.
+	 */
+	void setLocalSearch(int elites, int moves);
+
 private:
+	/**
+	 * Compute the flow amount sum of the detectors in the specified edge.
+	 * @param edgeId	The edge identifier.
+	 * @return			The flow amount sum of the detectors in the specified edge.
+	 */
+	int computeDetFlowSumPerEdge(const std::string& edgeId) const;
+
 	//! The network data
 	const GARNet const* pNet;
 
@@ -112,6 +341,54 @@ private:
 	//! The detector flow measurements
 	const GARDetectorFlows const* pDetFlows;
 
+	//! The edge identifiers per dense edge index
+	std::vector<std::string> edgeIds;
+
+	//! The CSR row offsets of the route-to-edge incidence
+	std::vector<uint32_t> routeEdgeOffsets;
+
+	//! The CSR dense edge indices of the route-to-edge incidence
+	std::vector<uint32_t> routeEdgeIndices;
+
+	//! The dense indices of the edges carrying detectors
+	std::vector<uint32_t> targetEdges;
+
+	//! The detector flow sum of every target edge
+	std::vector<int> targetFlows;
+
+	//! Maps the route names to the route indices
+	std::unordered_map<std::string, uint32_t> routeIndices;
+
+	//! The OD pair index of every gene of the static genome
+	std::vector<uint32_t> geneOds;
+
+	//! The first gene of every OD pair, with a last entry for the number of genes
+	std::vector<uint32_t> odGeneOffsets;
+
+	//! The offsets of the candidate routes of every OD pair
+	std::vector<uint32_t> odRouteOffsets;
+
+	//! The route indices of the candidate routes of the OD pairs
+	std::vector<uint32_t> odRoutes;
+
+	//! The number of trips of every OD pair
+	std::vector<uint32_t> odTrips;
+
+	//! Whether the genomes are evaluated by updating the genes changed since their last evaluation
+	bool deltaEvaluation;
+
+	//! The crossover operator wrapped by the delta evaluation crossover
+	GAGenome::SexualCrossover crossover;
+
+	//! The genome score cache
+	GARFitnessCache* pFitnessCache;
+
+	//! The number of best individuals refined by the local search
+	int localSearchElites;
+
+	//! The number of moves the local search tries on every refined individual
+	int localSearchMoves;
+
 	//! The application logger
 	CLogger* logger;
 
@@ -11,13 +11,27 @@
 #include <GARDetector.hpp>
 #include <GARDetectorFlow.hpp>
 #include <GARRouteCont.hpp>
+#include <GARCountGenome.hpp>
+#include <GARFitnessCache.hpp>
 #include <utils/common/StdDefs.h>
 #include <ga/ga.h>
+#include <vector>
+#include <cstdint>
 
 namespace gar {
 
-typedef GA1DArrayAlleleGenome<const char*> genome_static;
+typedef GA1DArrayAlleleGenome<uint16_t> genome_static;
+typedef GA1DArrayAlleleGenome<uint32_t> genome_static_wide;
 
+class GARStaticObjData;
+class GARStaticEvalData;
+
+/**
+ * The objective, the genetic operators and the evaluation state of the trip genome of the static approach.
+ * The trip genome functions are templates over the trip genome: <code>genome_static</code>, whose 16-bit
+ * alleles hold the local route indices, or <code>genome_static_wide</code> when some OD pair has more
+ * candidate routes than a 16-bit allele holds. Both are instantiated in the implementation file.
+ */
 class GARStaticObjective {
 public:
 	/**
@@ -35,40 +49,303 @@ public:
 	 * @param __genome	The genome of the genetic algorithm.
 	 * @return			The score assigned to the genome.
 	 */
+	template<class Genome>
 	static float objective(GAGenome& __genome);
 
+	/**
+	 * The GA objective function for the static solution with the count-per-route encoding.
+	 * @param __genome	The count-per-route genome of the genetic algorithm.
+	 * @return			The score assigned to the genome.
+	 */
+	static float countObjective(GAGenome& __genome);
+
 	/**
 	 * Get the accumulative flow data per edge from the route data in the genome.
-	 * @param genome	An individual genome in the genetic algorithm population.
-	 * 					This genome comprises the routes to be performed by the SUMO simulation.
-	 * @return
+	 * The flow counts are accumulated through the route-to-edge incidence of the objective data
+	 * into a flat array indexed by the dense edge index.
+	 * @param pData			The objective data holding the route-to-edge incidence.
+	 * @param genome		An individual genome in the genetic algorithm population.
+	 * 						This genome comprises the routes to be performed by the SUMO simulation.
+	 * @param edgeCounts	The flow counts per dense edge index. It is resized and overwritten.
 	 */
-	static std::map<std::string,std::shared_ptr<int>> getEdgeFlowCounts(const GARRouteCont const* pRouCont,
-													  	  	  	  	  	const genome_static& genome);
+	template<class Genome>
+	static void getEdgeFlowCounts(const GARStaticObjData const* pData,
+								  const Genome& genome,
+								  std::vector<uint32_t>& edgeCounts);
+
+	/**
+	 * Get the accumulative flow data per edge from the route counts in the genome.
+	 * Every route adds its trip count to the flow counts of its edges.
+	 * @param pData			The objective data holding the route-to-edge incidence and the gene layout.
+	 * @param genome		An individual count-per-route genome in the genetic algorithm population.
+	 * @param edgeCounts	The flow counts per dense edge index. It is resized and overwritten.
+	 */
+	static void getEdgeFlowCounts(const GARStaticObjData const* pData,
+								  const GARCountGenome& genome,
+								  std::vector<uint32_t>& edgeCounts);
 
 	/**
 	 * Compute the score by matching the flow amounts on every edge against the detector flows measurements.
-	 * @param edgeFlows	The flow amounts per edge.
-	 * @param pDetCont	The detectors container.
-	 * @param pDetFlows	The detector flows measurements.
-	 * @return			The score as result of matching the flow amounts on every edge against the detector
-	 * 					flows measurements.
-	 */
-	static float computeScore(const GARNet const* pNet,
-							  const GARDetectorCon const* pDetCont,
-							  const GARDetectorFlows const* pDetFlows,
-							  const std::map<std::string,std::shared_ptr<int>>& edgeFlows);
-
-	/**
-	 * Compute the flow amount sum of the detectors in the specified edge.
-	 * @param edgeId	The edge identifier.
-	 * @param pDetCont	The detectors container.
-	 * @param pDetFlows	The detector flows.
-	 * @return			The flow amount sum of the detectors in the specified edge.
-	 */
-	static int computeDetFlowSumPerEdge(const std::string& edgeId,
-					   	   	      	    const GARDetectorCon const* pDetCont,
-										const GARDetectorFlows const* pDetFlows);
+	 * The edges without detectors are matched against a zero flow.
+	 * @param pData			The objective data holding the detector flow targets per edge.
+	 * @param edgeCounts	The flow counts per dense edge index.
+	 * @return				The score as result of matching the flow amounts on every edge against the detector
+	 * 						flows measurements.
+	 */
+	static float computeScore(const GARStaticObjData const* pData,
+							  const std::vector<uint32_t>& edgeCounts);
+
+	/**
+	 * Compute the score from the sum of the squared edge flow residuals.
+	 * The squared residuals are integers, so their sum is exact and the score matches
+	 * the one computed by {@link #computeScore}.
+	 * @param sqErrorSum	The sum of the squared edge flow residuals.
+	 * @param numEdges		The number of dense edges.
+	 * @return				The score.
+	 */
+	static float computeScore(int64_t sqErrorSum,
+							  uint32_t numEdges);
+
+	/**
+	 * @brief Evaluate the genome by updating its previous evaluation state.
+	 * Only the genes changed since the last evaluation of the genome are processed: the edges of
+	 * their old routes are decremented and the edges of their new routes incremented, updating the
+	 * edge flow residuals and the squared error sum accordingly. The genome is fully recounted
+	 * when it has no previous evaluation state or when most of its genes changed.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The objective data.
+	 * @return			The score assigned to the genome.
+	 */
+	template<class Genome>
+	static float deltaObjective(Genome& genome,
+								const GARStaticObjData const* pData);
+
+	/**
+	 * Recount the edge flow residuals and the squared error sum of the genome into its evaluation state.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The objective data.
+	 * @param evalData	The evaluation state of the genome.
+	 */
+	template<class Genome>
+	static void computeResiduals(const Genome& genome,
+								 const GARStaticObjData const* pData,
+								 GARStaticEvalData& evalData);
+
+	/**
+	 * Bring the evaluation state of the genome up to date with its genes, attaching one on the
+	 * first call. Only the genes changed since the last update are processed, unless the genome
+	 * has no previous evaluation state or most of its genes changed.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @param pData		The objective data.
+	 * @return			The evaluation state of the genome.
+	 */
+	template<class Genome>
+	static GARStaticEvalData* syncEvalData(Genome& genome,
+										   const GARStaticObjData const* pData);
+
+	/**
+	 * @brief The crossover operator used with the delta evaluation.
+	 * Every child starts from the evaluation state of the parent it is mated from, and then
+	 * the crossover operator registered in the objective data is applied. This way the next
+	 * evaluation of a child only processes the genes taken from the other parent or mutated.
+	 * @param mom	The mother genome.
+	 * @param dad	The father genome.
+	 * @param bro	The first child genome, if any.
+	 * @param sis	The second child genome, if any.
+	 * @return		The number of children generated.
+	 */
+	template<class Genome>
+	static int deltaCrossover(const GAGenome& mom,
+							  const GAGenome& dad,
+							  GAGenome* bro,
+							  GAGenome* sis);
+
+	/**
+	 * The flip mutation operator of GAlib, recording the mutated genes in the evaluation
+	 * state of the genome for the delta evaluation.
+	 * @param __genome	The genome to mutate.
+	 * @param pmut		The mutation probability.
+	 * @return			The number of mutated genes.
+	 */
+	template<class Genome>
+	static int flipMutator(GAGenome& __genome,
+						   float pmut);
+
+	/**
+	 * The swap mutation operator of GAlib, swapping genes of the same OD pair only, and recording
+	 * the swapped genes in the evaluation state of the genome for the delta evaluation.
+	 * @param __genome	The genome to mutate.
+	 * @param pmut		The mutation probability.
+	 * @return			The number of swaps.
+	 */
+	template<class Genome>
+	static int swapMutator(GAGenome& __genome,
+						   float pmut);
+
+	/**
+	 * The uniform initializer of GAlib, invalidating the evaluation state of the genome.
+	 * @param genome	The genome to initialize.
+	 */
+	template<class Genome>
+	static void uniformInitializer(GAGenome& genome);
+
+	/**
+	 * The ordered initializer of GAlib, shuffling the genes within every OD pair only,
+	 * and invalidating the evaluation state of the genome.
+	 * @param __genome	The genome to initialize.
+	 */
+	template<class Genome>
+	static void orderedInitializer(GAGenome& __genome);
+
+	/**
+	 * Invalidate the evaluation state of a genome whose genes were set outside the genetic
+	 * operators, so its next evaluation recounts it.
+	 * @param genome	The genome.
+	 */
+	static void invalidateEvalData(GAGenome& genome);
+
+	/**
+	 * @brief The residual-guided mutation operator.
+	 * It mutates as many genes as the flip mutator, but the genes are not picked blindly: every
+	 * mutated gene is the one, out of a few random genes, whose route carries the largest excess
+	 * flow over the edges it passes. The gene is moved to the candidate route of its OD pair that
+	 * reduces the squared error the most, which drains the over-counted edges into the under-counted
+	 * ones. If no candidate route improves the error, a random one is taken, as the flip mutator does.
+	 * The edge flow residuals are updated after every move, so the moves don't overshoot each other.
+	 * With the delta evaluation, the moves start from the residuals in the evaluation state of the
+	 * genome and are applied to it, so neither the mutator nor the next evaluation recounts the genome.
+	 * @param __genome	The genome to mutate.
+	 * @param pmut		The mutation probability.
+	 * @return			The number of mutated genes.
+	 */
+	template<class Genome>
+	static int residualMutator(GAGenome& __genome,
+							   float pmut);
+
+	/**
+	 * @brief Refine a genome with a bounded hill-climbing local search.
+	 * Every move picks a gene carrying excess flow, as the residual-guided mutator does, and tries
+	 * every candidate route of its OD pair. The best route is taken if it reduces the squared error.
+	 * A move costs the length of the candidate routes, since only the edge flow residuals of the
+	 * routes involved are updated. The genome score is set from the residuals when it improves.
+	 * With the delta evaluation, the search starts from the residuals in the evaluation state of
+	 * the genome and commits the moves to it.
+	 * @param genome	The genome to refine.
+	 * @param pData		The objective data.
+	 * @param maxMoves	The number of moves tried.
+	 * @return			The number of moves taken.
+	 */
+	template<class Genome>
+	static int localSearch(Genome& genome,
+						   const GARStaticObjData const* pData,
+						   int maxMoves);
+
+	/**
+	 * @brief The memetic population evaluator.
+	 * It evaluates the population with the population evaluator, and then refines the best
+	 * individuals with the local search, as set in the objective data.
+	 * @param pop	The population to evaluate.
+	 * @see GARPopulationEvaluator
+	 */
+	template<class Genome>
+	static void memeticEvaluator(GAPopulation& pop);
+
+	/**
+	 * Compute the score cache key of a genome.
+	 * The key hashes the sorted routes taken by the genes, so the genomes taking the same routes
+	 * share the key whatever their alleles and gene order within the OD pairs.
+	 * @param genome	An individual genome in the genetic algorithm population.
+	 * @return			The hash of the genome routes.
+	 */
+	template<class Genome>
+	static Hash128 genomeKey(const Genome& genome);
+
+	/**
+	 * Compute the score cache key of a count-per-route genome.
+	 * @param genome	An individual count-per-route genome in the genetic algorithm population.
+	 * @return			The hash of the genome genes.
+	 */
+	static Hash128 genomeKey(const GARCountGenome& genome);
+
+private:
+	/**
+	 * Record the genes a child took from the other parent in the evaluation state it took
+	 * from its parent.
+	 * @param parent	The parent the child took the evaluation state from.
+	 * @param child		The child genome.
+	 */
+	template<class Genome>
+	static void recordChanges(const Genome& parent,
+							  Genome& child);
+
+	/**
+	 * Compute the edge flow residuals of the genome into the residual buffer of the thread.
+	 * @param pData		The objective data.
+	 * @param genome	The genome.
+	 * @return			The sum of the squared edge flow residuals.
+	 */
+	template<class Genome>
+	static int64_t computeEdgeResiduals(const GARStaticObjData const* pData,
+										const Genome& genome);
+
+	/**
+	 * Pick the gene whose route carries the largest excess flow out of a few random genes.
+	 * @param pData			The objective data.
+	 * @param genome		The genome.
+	 * @param edgeResiduals	The edge flow residuals of the genome.
+	 * @return				The gene position.
+	 */
+	template<class Genome>
+	static int pickExcessGene(const GARStaticObjData const* pData,
+							  const Genome& genome,
+							  const std::vector<int32_t>& edgeResiduals);
+
+	/**
+	 * Add or remove the flows of a route to the edge flow residuals.
+	 * @param pData			The objective data.
+	 * @param route			The route index, nothing is moved if it is negative.
+	 * @param sign			<code>1</code> to add the flows, <code>-1</code> to remove them.
+	 * @param edgeResiduals	The edge flow residuals.
+	 * @return				The change of the squared error sum.
+	 */
+	static int64_t moveRouteFlows(const GARStaticObjData const* pData,
+								  int route,
+								  int sign,
+								  std::vector<int32_t>& edgeResiduals);
+
+	/**
+	 * Find the candidate route of a gene adding the least error to the edge flow residuals.
+	 * @param pData			The objective data.
+	 * @param gene			The gene position, whose current route is removed from the residuals.
+	 * @param edgeResiduals	The edge flow residuals.
+	 * @param[in,out] delta	The change of the squared error sum, increased by the error the route adds.
+	 * @return				The allele of the best candidate route.
+	 */
+	static uint32_t bestGeneAllele(const GARStaticObjData const* pData,
+								   int gene,
+								   const std::vector<int32_t>& edgeResiduals,
+								   int64_t& delta);
+
+	//! The edge flow count buffer of the evaluating thread, reused between evaluations
+	static thread_local std::vector<uint32_t> edgeCounts;
+
+	//! The changed gene positions buffer of the evaluating thread, reused between evaluations
+	static thread_local std::vector<int> changedGenes;
+
+	//! The number of random genes competing for every residual-guided mutation
+	static const int RESIDUAL_TOURNAMENT_SIZE;
+
+	//! The edge flow residual buffer of the mutating thread, reused between mutations
+	static thread_local std::vector<int32_t> residuals;
+
+	//! The elite buffer of the memetic evaluator
+	static thread_local std::vector<GAGenome*> elites;
+
+	//! The route buffer of the evaluating thread used to hash the genomes
+	static thread_local std::vector<int> staticRoutes;
+
+	//! The gene buffer of the evaluating thread used to hash the count-per-route genomes
+	static thread_local std::vector<int> countGenes;
 };
 
 } /* namespace gar */
@@ -0,0 +1,131 @@
+/*
+ * GARSumoWorkerPool.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: ctomas
+ */
+
+#ifndef GARSUMOWORKERPOOL_HPP_
+#define GARSUMOWORKERPOOL_HPP_
+
+#include <CLogger.hpp>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+using common::CLogger;
+
+namespace gar {
+
+/**
+ * @brief The private files of a SUMO worker.
+ * Every worker owns a temporary directory holding its own copy of the induction loop file
+ * and its own emitter file. SUMO resolves the induction loop output relative to the induction
+ * loop file, so the loop measurements of the worker are also written into its directory.
+ */
+struct GARSumoSandbox {
+	//! The private working directory
+	std::string dir;
+
+	//! The induction loop file of the worker
+	std::string loopFile;
+
+	//! The emitter file of the worker
+	std::string emitFile;
+
+	//! The induction loop measurement file written by the worker simulations
+	std::string measFile;
+};
+
+
+/**
+ * @brief This class implements a pool of SUMO worker sandboxes.
+ * The objective function of the dynamic approach acquires a sandbox, runs its SUMO simulation
+ * on the files of the sandbox and releases it. The number of sandboxes bounds the number of
+ * SUMO processes running at the same time.
+ */
+class GARSumoWorkerPool {
+public:
+	/**
+	 * Deleted default constructor.
+	 */
+	GARSumoWorkerPool(void) = delete;
+
+	/**
+	 * Deleted copy constructor.
+	 * @param other	Other worker pool.
+	 */
+	GARSumoWorkerPool(const GARSumoWorkerPool& other) = delete;
+
+	/**
+	 * Deleted assignment operator.
+	 * @param rhs	Other worker pool.
+	 * @return		This worker pool.
+	 */
+	GARSumoWorkerPool& operator=(const GARSumoWorkerPool& rhs) = delete;
+
+	/**
+	 * Parameterized constructor.
+	 * @param logger	Reference to the ga-router logger.
+	 */
+	GARSumoWorkerPool(CLogger* logger);
+
+	/**
+	 * Virtual destructor.
+	 * Removes the sandbox directories.
+	 */
+	virtual ~GARSumoWorkerPool(void);
+
+	/**
+	 * Create the worker sandboxes under the system temporary directory.
+	 * @param numWorkers	The number of workers.
+	 * @param loopFile		The induction loop file to copy into every sandbox.
+	 * @return				<code>0</code> if the sandboxes are successfully created,
+	 * 						<code>1</code> otherwise.
+	 */
+	int createSandboxes(unsigned int numWorkers, const std::string& loopFile);
+
+	/**
+	 * Get the number of worker sandboxes.
+	 * @return	The number of worker sandboxes.
+	 */
+	unsigned int size(void) const;
+
+	/**
+	 * Acquire an idle sandbox, waiting until one is released if all of them are busy.
+	 * @return	A pointer to the acquired sandbox.
+	 */
+	const GARSumoSandbox* acquire(void);
+
+	/**
+	 * Release a sandbox acquired with acquire().
+	 * @param pSandbox	A pointer to the sandbox.
+	 */
+	void release(const GARSumoSandbox* pSandbox);
+
+private:
+	/**
+	 * Remove the sandbox directories and their files.
+	 */
+	void removeSandboxes(void);
+
+	//! The worker sandboxes
+	std::vector<GARSumoSandbox> sandboxes;
+
+	//! The sandboxes not in use
+	std::vector<const GARSumoSandbox*> idle;
+
+	//! Guards the idle sandboxes
+	std::mutex mtx;
+
+	//! Wakes up the evaluations waiting for a sandbox
+	std::condition_variable idleCond;
+
+	//! The application logger
+	CLogger* logger;
+};
+
+} /* namespace gar */
+
+#endif /* GARSUMOWORKERPOOL_HPP_ */
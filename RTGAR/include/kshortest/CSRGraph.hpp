@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+///  CSRGraph.hpp
+///  A directed, weighted graph in compressed sparse row (CSR) form, with
+///  integer vertex and edge identifiers.
+///
+///  @remarks The vertices are numbered 0..n-1 and the edges keep the index
+///           of the link they were built from, so parallel edges stay
+///           distinct. The graph is immutable once built and can be shared
+///           by concurrent searches.
+///
+///  @author ctomas @date 10/16/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct CSRLink
+{
+	uint32_t u;
+	uint32_t v;
+	double weight;
+};
+
+
+class CSRPath {
+public:
+	CSRPath(void) : m_dWeight(0.) {
+		// Intentionally left empty
+	}
+
+	double Weight() const { return m_dWeight; }
+	void Weight(double val) { m_dWeight = val; }
+
+	// The number of vertices in the path
+	int length() const { return m_vtVertexList.size(); }
+
+	uint32_t GetVertex(int i) const { return m_vtVertexList.at(i); }
+	uint32_t GetEdge(int i) const { return m_vtEdgeList.at(i); }
+
+	const std::vector<uint32_t>& vertices() const { return m_vtVertexList; }
+	const std::vector<uint32_t>& edges() const { return m_vtEdgeList; }
+
+	std::vector<uint32_t>& vertices() { return m_vtVertexList; }
+	std::vector<uint32_t>& edges() { return m_vtEdgeList; }
+
+	// convert the path to a string of vertex identifiers
+	std::string toString(void) const {
+		std::string str = "";
+		for (size_t i = 0; i < m_vtVertexList.size(); i++) {
+			str += std::to_string(m_vtVertexList[i]);
+			if (i + 1 < m_vtVertexList.size()) {
+				str += "-";
+			}
+		}
+		return str;
+	}
+
+private:
+	double m_dWeight;
+	std::vector<uint32_t> m_vtVertexList;
+	std::vector<uint32_t> m_vtEdgeList;
+};
+
+
+class CSRGraph {
+public:
+	CSRGraph(void) : m_nVertexNum(0) {
+		m_vtOffset.assign(1, 0);
+	}
+
+	// Build the graph of num_vertices vertices from its links. Edge i is links[i].
+	CSRGraph(uint32_t num_vertices, const std::vector<CSRLink>& links);
+
+	uint32_t get_number_vertices() const { return m_nVertexNum; }
+	uint32_t get_number_edges() const { return m_vtEdgeFrom.size(); }
+
+	// The outgoing edges of vertex u are the slots first_out(u)..first_out(u+1)-1
+	uint32_t first_out(uint32_t u) const { return m_vtOffset[u]; }
+	uint32_t slot_edge(uint32_t slot) const { return m_vtSlotEdge[slot]; }
+	uint32_t slot_target(uint32_t slot) const { return m_vtSlotTarget[slot]; }
+	double slot_weight(uint32_t slot) const { return m_vtSlotWeight[slot]; }
+
+	uint32_t get_edge_source(uint32_t edge) const { return m_vtEdgeFrom[edge]; }
+	uint32_t get_edge_target(uint32_t edge) const { return m_vtEdgeTo[edge]; }
+	double get_edge_weight(uint32_t edge) const { return m_vtEdgeWeight[edge]; }
+
+private:
+	uint32_t m_nVertexNum;
+
+	// CSR arrays, ordered by source vertex
+	std::vector<uint32_t> m_vtOffset;
+	std::vector<uint32_t> m_vtSlotEdge;
+	std::vector<uint32_t> m_vtSlotTarget;
+	std::vector<double> m_vtSlotWeight;
+
+	// Edge arrays, indexed by edge identifier
+	std::vector<uint32_t> m_vtEdgeFrom;
+	std::vector<uint32_t> m_vtEdgeTo;
+	std::vector<double> m_vtEdgeWeight;
+};
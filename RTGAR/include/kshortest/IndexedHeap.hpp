@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+///  IndexedHeap.hpp
+///  A binary min-heap of integer items keyed by a priority, supporting
+///  decrease-key through an item position index.
+///
+///  @remarks The heap is sized once for the items 0..n-1 and reused between
+///           searches; clear() only resets the items actually pushed.
+///
+///  @author ctomas @date 10/16/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+template<class K>
+class IndexedHeap {
+public:
+	IndexedHeap(void) {
+		// Intentionally left empty
+	}
+
+	explicit IndexedHeap(uint32_t num_items) {
+		resize(num_items);
+	}
+
+	// Size the heap for the items 0..num_items-1, emptying it
+	void resize(uint32_t num_items) {
+		m_vtHeap.clear();
+		m_vtPosition.assign(num_items, NOT_IN_HEAP);
+	}
+
+	bool empty(void) const {
+		return m_vtHeap.empty();
+	}
+
+	uint32_t size(void) const {
+		return m_vtHeap.size();
+	}
+
+	bool contains(uint32_t item) const {
+		return m_vtPosition[item] != NOT_IN_HEAP;
+	}
+
+	uint32_t top(void) const {
+		return m_vtHeap.front().second;
+	}
+
+	K top_key(void) const {
+		return m_vtHeap.front().first;
+	}
+
+	// Push an item, or lower its key if it is already in the heap
+	void push_or_decrease(uint32_t item, K key) {
+		uint32_t pos = m_vtPosition[item];
+		if (pos == NOT_IN_HEAP) {
+			pos = m_vtHeap.size();
+			m_vtHeap.push_back(std::make_pair(key, item));
+			m_vtPosition[item] = pos;
+		} else if (key < m_vtHeap[pos].first) {
+			m_vtHeap[pos].first = key;
+		} else {
+			return;
+		}
+		_sift_up(pos);
+	}
+
+	uint32_t pop(void) {
+		uint32_t item = m_vtHeap.front().second;
+		m_vtPosition[item] = NOT_IN_HEAP;
+
+		if (m_vtHeap.size() > 1) {
+			m_vtHeap.front() = m_vtHeap.back();
+			m_vtPosition[m_vtHeap.front().second] = 0;
+			m_vtHeap.pop_back();
+			_sift_down(0);
+		} else {
+			m_vtHeap.pop_back();
+		}
+
+		return item;
+	}
+
+	void clear(void) {
+		for (const std::pair<K, uint32_t>& entry : m_vtHeap) {
+			m_vtPosition[entry.second] = NOT_IN_HEAP;
+		}
+		m_vtHeap.clear();
+	}
+
+private:
+	static const uint32_t NOT_IN_HEAP = 0xFFFFFFFFu;
+
+	void _sift_up(uint32_t pos) {
+		std::pair<K, uint32_t> entry = m_vtHeap[pos];
+		while (pos > 0) {
+			uint32_t parent = (pos - 1) / 2;
+			if (!(entry.first < m_vtHeap[parent].first)) {
+				break;
+			}
+			m_vtHeap[pos] = m_vtHeap[parent];
+			m_vtPosition[m_vtHeap[pos].second] = pos;
+			pos = parent;
+		}
+		m_vtHeap[pos] = entry;
+		m_vtPosition[entry.second] = pos;
+	}
+
+	void _sift_down(uint32_t pos) {
+		const uint32_t n = m_vtHeap.size();
+		std::pair<K, uint32_t> entry = m_vtHeap[pos];
+		while (true) {
+			uint32_t child = 2 * pos + 1;
+			if (child >= n) {
+				break;
+			}
+			if (child + 1 < n && m_vtHeap[child + 1].first < m_vtHeap[child].first) {
+				child++;
+			}
+			if (!(m_vtHeap[child].first < entry.first)) {
+				break;
+			}
+			m_vtHeap[pos] = m_vtHeap[child];
+			m_vtPosition[m_vtHeap[pos].second] = pos;
+			pos = child;
+		}
+		m_vtHeap[pos] = entry;
+		m_vtPosition[entry.second] = pos;
+	}
+
+	// The (key, item) pairs in heap order
+	std::vector< std::pair<K, uint32_t> > m_vtHeap;
+
+	// The heap position of every item
+	std::vector<uint32_t> m_vtPosition;
+};
+
+template<class K>
+const uint32_t IndexedHeap<K>::NOT_IN_HEAP;
@@ -0,0 +1,50 @@
+#!/bin/bash
+
+# Check that a run interrupted at a checkpoint and resumed reaches the same static solution
+# as an uninterrupted run with the same seed.
+# Usage: checkpoint_check.sh <garcfg> [generations] [interrupt generation] [checkpoint interval] [seed]
+
+export RTGAR=${RTGAR:-~/RTGAR}
+
+CONFIG=$1
+GENERATIONS=${2:-40}
+INTERRUPT=${3:-20}
+INTERVAL=${4:-10}
+SEED=${5:-12345}
+
+if [ -z "${CONFIG}" ]; then
+	echo "Usage: $0 <garcfg> [generations] [interrupt generation] [checkpoint interval] [seed]"
+	exit 2
+fi
+if [ $((INTERRUPT % INTERVAL)) -ne 0 ]; then
+	echo "The interrupt generation must be a multiple of the checkpoint interval"
+	exit 2
+fi
+
+WORK=$(mktemp -d)
+GAROUTER="${RTGAR}/bin/garouter -c ${CONFIG} --ga-seed ${SEED} --checkpoint-interval ${INTERVAL}"
+
+echo "Uninterrupted run of ${GENERATIONS} generations..."
+${GAROUTER} --number-of-generations ${GENERATIONS} \
+	--checkpoint-file ${WORK}/full.bin --score-file ${WORK}/full_stats.dat \
+	--incumbent-routes-output ${WORK}/full.txt > ${WORK}/full.log 2>&1 || { echo "The uninterrupted run failed"; exit 1; }
+
+echo "Run interrupted at generation ${INTERRUPT}..."
+${GAROUTER} --number-of-generations ${INTERRUPT} \
+	--checkpoint-file ${WORK}/part.bin --score-file ${WORK}/part_stats.dat \
+	> ${WORK}/part.log 2>&1 || { echo "The interrupted run failed"; exit 1; }
+
+echo "Resumed run up to generation ${GENERATIONS}..."
+${GAROUTER} --number-of-generations ${GENERATIONS} --resume true \
+	--checkpoint-file ${WORK}/part.bin --score-file ${WORK}/resumed_stats.dat \
+	--incumbent-routes-output ${WORK}/resumed.txt > ${WORK}/resumed.log 2>&1 || { echo "The resumed run failed"; exit 1; }
+
+if ! diff -q ${WORK}/full.txt ${WORK}/resumed.txt > /dev/null; then
+	echo "FAILED: the resumed run diverges from the uninterrupted one (see ${WORK})"
+	exit 1
+fi
+
+echo "OK: the resumed run reproduces the uninterrupted one"
+rm -rf ${WORK}
+
+exit 0